@@ -0,0 +1,58 @@
+/**
+ * @file bit_ops.hpp
+ * @brief Portable 64-bit word operations used by the bitset graph types
+ *
+ * Wraps population count and count-trailing-zeros in the compiler builtins
+ * (GCC/Clang) or intrinsics (MSVC), with a plain C++ fallback.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#endif
+
+namespace xnetwork {
+
+    namespace detail {
+
+        /** @brief Number of set bits in a 64-bit word */
+        inline auto popcount64(uint64_t word) -> unsigned {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_popcountll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+            return static_cast<unsigned>(__popcnt64(word));
+#else
+            word = word - ((word >> 1) & 0x5555555555555555ULL);
+            word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+            word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return static_cast<unsigned>((word * 0x0101010101010101ULL) >> 56);
+#endif
+        }
+
+        /** @brief Index of the lowest set bit of a non-zero 64-bit word */
+        inline auto ctz64(uint64_t word) -> unsigned {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+            unsigned long idx = 0;
+            _BitScanForward64(&idx, word);
+            return static_cast<unsigned>(idx);
+#else
+            unsigned idx = 0;
+            while ((word & 1U) == 0) {
+                word >>= 1;
+                ++idx;
+            }
+            return idx;
+#endif
+        }
+
+        /** @brief Number of 64-bit words needed to hold `num_bits` bits */
+        constexpr auto words_for(uint64_t num_bits) -> uint64_t { return (num_bits + 63) / 64; }
+
+    }  // namespace detail
+
+}  // namespace xnetwork
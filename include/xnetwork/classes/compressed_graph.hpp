@@ -0,0 +1,340 @@
+/**
+ * @file compressed_graph.hpp
+ * @brief Read-only undirected graph with gap + varint compressed adjacency
+ *
+ * Defines the CompressedGraph class and the compress() helper. Every sorted
+ * neighbor list is stored as a byte stream of variable-length integers: the
+ * degree, the (zigzag) distance of the first neighbor from the node itself,
+ * then the gaps between consecutive neighbors. On graphs with locality
+ * (e.g. after a bandwidth-reducing reordering) most gaps fit in one byte,
+ * about a quarter of a uint32_t CSR entry.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <py2cpp/range.hpp>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/memory_usage.hpp>
+#include <xnetwork/classes/reportviews.hpp>
+
+namespace xnetwork {
+
+    namespace detail {
+
+        /** @brief Append `value` as an LEB128 varint (7 bits per byte, high bit = more) */
+        inline void put_varint(std::vector<uint8_t>& out, uint64_t value) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        /** @brief Decode an LEB128 varint and advance `ptr` past it */
+        inline auto get_varint(const uint8_t*& ptr) -> uint64_t {
+            uint64_t value = *ptr & 0x7FU;
+            unsigned shift = 7;
+            while ((*ptr++ & 0x80U) != 0) {
+                value |= uint64_t{*ptr & 0x7FU} << shift;
+                shift += 7;
+            }
+            return value;
+        }
+
+        /** @brief Map a signed difference to an unsigned code (0, -1, 1, -2, ... -> 0, 1, 2, 3) */
+        inline auto zigzag(int64_t value) -> uint64_t {
+            return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        }
+
+        /** @brief Inverse of zigzag() */
+        inline auto unzigzag(uint64_t code) -> int64_t {
+            return static_cast<int64_t>(code >> 1) ^ -static_cast<int64_t>(code & 1U);
+        }
+
+        /** @brief Append the encoding of one sorted, duplicate-free neighbor list
+            @param[out] out Byte stream
+            @param[in] node The node owning the list
+            @param[in] first Iterator to the smallest neighbor
+            @param[in] last Iterator past the largest neighbor */
+        template <typename It>
+        void encode_row(std::vector<uint8_t>& out, uint32_t node, It first, It last) {
+            put_varint(out, static_cast<uint64_t>(std::distance(first, last)));
+            if (first == last) return;
+            uint32_t prev = *first;
+            put_varint(out, zigzag(int64_t{prev} - int64_t{node}));
+            for (++first; first != last; ++first) {
+                assert(*first > prev);
+                put_varint(out, uint64_t{*first} - prev - 1);
+                prev = *first;
+            }
+        }
+
+    }  // namespace detail
+
+    /** @brief Read-only view of a compressed neighbor list, decoded while iterating */
+    class CompressedNeighbors {
+      public:
+        using value_type = uint32_t;
+        using key_type = uint32_t;
+        using size_type = size_t;
+
+        /** @brief Forward iterator that decodes one neighbor per increment */
+        class const_iterator {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = uint32_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const uint32_t*;
+            using reference = const uint32_t&;
+
+            const_iterator(const uint8_t* ptr, size_t remaining, uint32_t node)
+                : _ptr{ptr}, _remaining{remaining} {
+                if (this->_remaining != 0) {
+                    const auto delta = detail::unzigzag(detail::get_varint(this->_ptr));
+                    this->_node = static_cast<uint32_t>(int64_t{node} + delta);
+                }
+            }
+
+            auto operator*() const -> const uint32_t& { return this->_node; }
+
+            auto operator++() -> const_iterator& {
+                if (--this->_remaining != 0) {
+                    this->_node += static_cast<uint32_t>(detail::get_varint(this->_ptr)) + 1;
+                }
+                return *this;
+            }
+
+            auto operator++(int) -> const_iterator {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            auto operator==(const const_iterator& other) const -> bool {
+                return this->_remaining == other._remaining;
+            }
+
+            auto operator!=(const const_iterator& other) const -> bool {
+                return !(*this == other);
+            }
+
+          private:
+            const uint8_t* _ptr;
+            size_t _remaining;
+            uint32_t _node = 0;
+        };
+
+        using iterator = const_iterator;
+
+        /** @brief Construct a view of the row of `node` starting at `row` */
+        CompressedNeighbors(const uint8_t* row, uint32_t node) : _node{node} {
+            this->_size = static_cast<size_t>(detail::get_varint(row));
+            this->_first = row;
+        }
+
+        auto begin() const -> const_iterator { return {this->_first, this->_size, this->_node}; }
+
+        auto end() const -> const_iterator { return {this->_first, 0, this->_node}; }
+
+        /** @brief Number of neighbors (stored, O(1)) */
+        auto size() const -> size_t { return this->_size; }
+
+        /** @brief Check if the neighbor list is empty */
+        auto empty() const -> bool { return this->_size == 0; }
+
+        /** @brief Check if a node is a neighbor (sequential decode, stops early) */
+        auto contains(uint32_t node) const -> bool {
+            for (const auto nbr : *this) {
+                if (nbr >= node) return nbr == node;
+            }
+            return false;
+        }
+
+      private:
+        const uint8_t* _first = nullptr;
+        size_t _size = 0;
+        uint32_t _node;
+    };
+
+    /** @brief Immutable undirected graph with compressed adjacency lists
+        @details Nodes are the dense integers 0 .. n-1. The row of node u lives
+        at `bytes[offsets[u] .. offsets[u + 1])` and decodes to its sorted
+        neighbors; every undirected edge appears in both rows. Neighbor access
+        is sequential only, so use it with algorithms that scan adjacency
+        lists (min_vertex_cover_fast, generic_bfs_cycle, ...). CompressedGraph
+        exposes the read surface of SimpleGraph so the templated algorithms can
+        be instantiated on it. Copies share the encoded arrays. */
+    class CompressedGraph {
+      public:
+        using node_t = uint32_t;
+        using Node = node_t;
+        using edge_t = std::pair<node_t, node_t>;
+        using offset_t = uint64_t;
+        using nodeview_t = decltype(py::range<uint32_t>(uint32_t{}));
+        using adjlist_t = CompressedNeighbors;
+        using key_type = node_t;
+        using value_type = node_t;
+
+        /** @brief Construct an empty graph with no nodes */
+        CompressedGraph() : CompressedGraph(std::vector<offset_t>{0}, std::vector<uint8_t>{}, 0) {}
+
+        /** @brief Construct a graph from encoded arrays (see compress())
+            @param[in] offsets Byte offset of each row, of size n + 1
+            @param[in] bytes Concatenated encoded rows
+            @param[in] num_edges Number of undirected edges */
+        CompressedGraph(std::vector<offset_t> offsets, std::vector<uint8_t> bytes,
+                        size_t num_edges)
+            : _arrays{std::make_shared<const Arrays>(Arrays{std::move(offsets), std::move(bytes)})},
+              _node{py::range<uint32_t>(static_cast<uint32_t>(_arrays->offsets.size() - 1))},
+              _num_of_edges{num_edges} {
+            assert(this->_arrays->offsets.back() == this->_arrays->bytes.size());
+        }
+
+        /**
+         * @brief For compatible with BGL adaptor
+         *
+         * @param[in] e
+         * @return const edge_t&
+         */
+        static auto end_points(const edge_t& e) -> const edge_t& { return e; }
+
+        /** @brief Begin iterator over nodes */
+        auto begin() const { return std::begin(this->_node); }
+
+        /** @brief End iterator over nodes */
+        auto end() const { return std::end(this->_node); }
+
+        /** @brief Check if a node is in the graph */
+        auto contains(const Node& node) const -> bool { return this->_node.contains(node); }
+
+        /** @brief Check if the graph contains a node */
+        auto has_node(const Node& node) const -> bool { return this->_node.contains(node); }
+
+        /** @brief Access the neighbor list of a node
+            @param[in] node The node to look up
+            @return View that decodes the neighbors in ascending order */
+        auto operator[](const Node& node) const -> adjlist_t {
+            return adjlist_t{this->_arrays->bytes.data() + this->_arrays->offsets[node], node};
+        }
+
+        /** @brief Access the neighbor list of a node (same as operator[]) */
+        auto at(const Node& node) const -> adjlist_t {
+            assert(this->_node.contains(node));
+            return (*this)[node];
+        }
+
+        /** @brief Get the number of nodes in the graph */
+        auto number_of_nodes() const -> size_t { return this->_node.size(); }
+
+        /** @brief Get the number of nodes (same as number_of_nodes) */
+        auto order() const -> size_t { return this->_node.size(); }
+
+        /** @brief Get the number of nodes (same as number_of_nodes) */
+        auto size() const -> size_t { return this->_node.size(); }
+
+        /** @brief Get the number of undirected edges (O(1)) */
+        auto number_of_edges() const -> size_t { return this->_num_of_edges; }
+
+        /** @brief Get the degree of a node (O(1), stored in the row header) */
+        auto degree(const Node& node) const -> size_t { return (*this)[node].size(); }
+
+        /** @brief Cached degree array with histogram and degree ordering
+            @details Decodes each row once; later degree lookups are array reads. */
+        auto degree_view() const -> DegreeView<CompressedGraph> {
+            return DegreeView<CompressedGraph>{*this};
+        }
+
+        /** @brief Check if an edge exists between two nodes (O(degree)) */
+        auto has_edge(const Node& node_u, const Node& node_v) const -> bool {
+            return (*this)[node_u].contains(node_v);
+        }
+
+        /** @brief Return a lazy view of all edges as (u, v) pairs
+            @details Each undirected edge is reported once with u < v, in
+            ascending (u, v) order, without allocating.
+            @return EdgeView over the edges */
+        auto edges() const -> EdgeView<CompressedGraph> { return EdgeView<CompressedGraph>{*this}; }
+
+        /** @brief Apply a callable to each edge (u, v) with u < v
+            @tparam F Callable `void(node_t, node_t)` or similar
+            @param[in] func Callable invoked for each edge */
+        template <typename F> auto for_each_edge(F&& func) const -> void {
+            for (const auto& node : this->_node) {
+                for (const auto nbr : (*this)[node]) {
+                    if (node < nbr) {
+                        std::forward<F>(func)(node, nbr);
+                    }
+                }
+            }
+        }
+
+        /** @brief Size of the encoded adjacency in bytes (excluding offsets) */
+        auto compressed_bytes() const -> size_t { return this->_arrays->bytes.size(); }
+
+        /** @brief Heap footprint of the encoded arrays (shared with copies of this graph) */
+        auto memory_usage() const -> MemoryUsage {
+            MemoryUsage usage;
+            usage.outer_adjacency = detail::heap_bytes(this->_arrays->offsets);
+            usage.inner_adjacency = detail::heap_bytes(this->_arrays->bytes);
+            return usage;
+        }
+
+        /** @brief Check if the graph is a multigraph
+            @return false (this is a simple graph) */
+        auto is_multigraph() const { return false; }
+
+        /** @brief Check if the graph is directed
+            @return false (this is an undirected graph) */
+        auto is_directed() const { return false; }
+
+      private:
+        struct Arrays {
+            std::vector<offset_t> offsets;
+            std::vector<uint8_t> bytes;
+        };
+
+        std::shared_ptr<const Arrays> _arrays;
+        nodeview_t _node;
+        size_t _num_of_edges = 0;
+    };
+
+    /** @brief Encode a graph with dense integer nodes into a CompressedGraph
+        @details The graph's nodes must be 0 .. n-1. Rows are encoded one at a
+        time, so the only scratch space is one sorted neighbor list. Rows that
+        are already sorted (CsrGraph, FlatSimpleGraph) are encoded as is.
+        @tparam Graph The source graph type
+        @param[in] gra The graph to compress
+        @return CompressedGraph with the same nodes and edges */
+    template <typename Graph> auto compress(const Graph& gra) -> CompressedGraph {
+        using offset_t = CompressedGraph::offset_t;
+        using node_t = CompressedGraph::node_t;
+
+        const auto num_nodes = gra.number_of_nodes();
+        std::vector<offset_t> offsets;
+        offsets.reserve(num_nodes + 1);
+        std::vector<uint8_t> bytes;
+        std::vector<node_t> row;
+        size_t num_edges = 0;
+        for (const auto& node : gra) {
+            offsets.push_back(bytes.size());
+            row.assign(gra[node].begin(), gra[node].end());
+            if (!std::is_sorted(row.begin(), row.end())) {
+                std::sort(row.begin(), row.end());
+            }
+            num_edges += static_cast<size_t>(
+                row.end() - std::lower_bound(row.begin(), row.end(), static_cast<node_t>(node)));
+            detail::encode_row(bytes, static_cast<node_t>(node), row.begin(), row.end());
+        }
+        offsets.push_back(bytes.size());
+        bytes.shrink_to_fit();
+        return CompressedGraph{std::move(offsets), std::move(bytes), num_edges};
+    }
+
+}  // namespace xnetwork
@@ -0,0 +1,320 @@
+/**
+ * @file csr_graph.hpp
+ * @brief Immutable compressed-sparse-row (CSR) snapshot of an undirected graph
+ *
+ * Defines the CsrGraph class and the freeze() helper that turns any graph with
+ * dense integer nodes (e.g. SimpleGraph) into a read-only CSR snapshot with
+ * contiguous, sorted neighbor arrays.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <py2cpp/range.hpp>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/memory_usage.hpp>
+#include <xnetwork/classes/reportviews.hpp>
+
+namespace xnetwork {
+
+    /** @brief Read-only view of the contiguous, sorted neighbor list of one node
+        @tparam T The node type */
+    template <typename T> class CsrNeighbors {
+      public:
+        using value_type = T;
+        using key_type = T;
+        using size_type = size_t;
+        using const_iterator = const T*;
+        using iterator = const T*;
+
+        /** @brief Construct a view over the half-open range [first, last)
+            @param[in] first Pointer to the first neighbor
+            @param[in] last Pointer past the last neighbor */
+        CsrNeighbors(const T* first, const T* last) : _first{first}, _last{last} {}
+
+        /** @brief Iterator to the first (smallest) neighbor */
+        auto begin() const -> const T* { return this->_first; }
+
+        /** @brief Iterator past the last neighbor */
+        auto end() const -> const T* { return this->_last; }
+
+        /** @brief Number of neighbors */
+        auto size() const -> size_t { return static_cast<size_t>(this->_last - this->_first); }
+
+        /** @brief Check if the neighbor list is empty */
+        auto empty() const -> bool { return this->_first == this->_last; }
+
+        /** @brief Check if a node is a neighbor (binary search, O(log deg))
+            @param[in] node The node to look up
+            @return true if node is in the list */
+        auto contains(const T& node) const -> bool {
+            return std::binary_search(this->_first, this->_last, node);
+        }
+
+        /** @brief Access the idx-th smallest neighbor */
+        auto operator[](size_t idx) const -> const T& { return this->_first[idx]; }
+
+      private:
+        const T* _first;
+        const T* _last;
+    };
+
+    /** @brief Immutable undirected graph in compressed-sparse-row layout
+        @details Nodes are the dense integers 0 .. n-1. The neighbors of node u are
+        stored contiguously and sorted in `neighbors[offsets[u] .. offsets[u + 1])`,
+        and every undirected edge (u, v) appears in both rows. A CsrGraph exposes the
+        same read-only surface as SimpleGraph (`node_t`, `operator[]`, `for_each_edge`,
+        `edges()`, ...) so the templated algorithms can be instantiated on it.
+
+        Because rows are sorted, the neighbors greater than u form a suffix of
+        row u. The graph can keep an "upper" offset per node marking where that
+        suffix starts (the half-adjacency), so edge-centric kernels
+        (for_each_edge(), edges()) touch each edge exactly once without a
+        `node < nbr` test, while vertex-centric kernels keep the full rows.
+
+        The arrays are shared between copies, so copying a snapshot is O(1).
+        They may be owned by the graph itself or borrowed from an external
+        owner such as a memory-mapped file (see open_binary_graph()). */
+    class CsrGraph {
+      public:
+        using node_t = uint32_t;
+        using Node = node_t;
+        using edge_t = std::pair<node_t, node_t>;
+        using offset_t = uint64_t;
+        using nodeview_t = decltype(py::range<uint32_t>(uint32_t{}));
+        using adjlist_t = CsrNeighbors<node_t>;
+        using key_type = node_t;
+        using value_type = node_t;
+
+        /** @brief Construct an empty graph with no nodes */
+        CsrGraph() : CsrGraph(std::vector<offset_t>{0}, std::vector<node_t>{}) {}
+
+        /** @brief Construct a graph from CSR arrays
+            @details Each row must be sorted and duplicate-free, and the adjacency
+            must be symmetric. The upper offsets are computed (O(n log deg)).
+            @param[in] offsets Row offsets of size n + 1 (offsets[0] == 0)
+            @param[in] neighbors Concatenated neighbor lists of size offsets[n] */
+        CsrGraph(std::vector<offset_t> offsets, std::vector<node_t> neighbors)
+            : CsrGraph{_make_arrays(std::move(offsets), std::move(neighbors))} {}
+
+        /** @brief Construct a zero-copy graph over arrays kept alive by `owner`
+            @details No validation or copying is done; the arrays must satisfy
+            the same invariants as in the vector constructor.
+            @param[in] owner Keeps the arrays alive (e.g. a file mapping)
+            @param[in] num_nodes Number of nodes n
+            @param[in] offsets Row offsets of size n + 1
+            @param[in] neighbors Concatenated neighbor lists of size offsets[n]
+            @param[in] num_edges Number of undirected edges
+            @param[in] upper Upper offsets of size n (see upper_offsets()), or
+                             nullptr to locate each row's upper half on demand */
+        CsrGraph(std::shared_ptr<const void> owner, uint32_t num_nodes, const offset_t* offsets,
+                 const node_t* neighbors, size_t num_edges, const offset_t* upper = nullptr)
+            : _owner{std::move(owner)},
+              _offsets{offsets},
+              _nbrs{neighbors},
+              _upper{upper},
+              _node{py::range<uint32_t>(num_nodes)},
+              _num_of_edges{num_edges} {}
+
+        /**
+         * @brief For compatible with BGL adaptor
+         *
+         * @param[in] e
+         * @return const edge_t&
+         */
+        static auto end_points(const edge_t& e) -> const edge_t& { return e; }
+
+        /** @brief Begin iterator over nodes */
+        auto begin() const { return std::begin(this->_node); }
+
+        /** @brief End iterator over nodes */
+        auto end() const { return std::end(this->_node); }
+
+        /** @brief Check if a node is in the graph */
+        auto contains(const Node& node) const -> bool { return this->_node.contains(node); }
+
+        /** @brief Check if the graph contains a node */
+        auto has_node(const Node& node) const -> bool { return this->_node.contains(node); }
+
+        /** @brief Access the sorted neighbor list of a node
+            @param[in] node The node to look up
+            @return Read-only view of the neighbors */
+        auto operator[](const Node& node) const -> adjlist_t {
+            return adjlist_t{this->_nbrs + this->_offsets[node],
+                             this->_nbrs + this->_offsets[node + 1]};
+        }
+
+        /** @brief Access the sorted neighbor list of a node (same as operator[]) */
+        auto at(const Node& node) const -> adjlist_t {
+            assert(this->_node.contains(node));
+            return (*this)[node];
+        }
+
+        /** @brief Get the number of nodes in the graph */
+        auto number_of_nodes() const -> size_t { return this->_node.size(); }
+
+        /** @brief Get the number of nodes (same as number_of_nodes) */
+        auto order() const -> size_t { return this->_node.size(); }
+
+        /** @brief Get the number of nodes (same as number_of_nodes) */
+        auto size() const -> size_t { return this->_node.size(); }
+
+        /** @brief Get the number of undirected edges (O(1)) */
+        auto number_of_edges() const -> size_t { return this->_num_of_edges; }
+
+        /** @brief Get the degree of a node (O(1)) */
+        auto degree(const Node& node) const -> size_t {
+            return static_cast<size_t>(this->_offsets[node + 1] - this->_offsets[node]);
+        }
+
+        /** @brief Cached degree array with histogram and degree ordering */
+        auto degree_view() const -> DegreeView<CsrGraph> { return DegreeView<CsrGraph>{*this}; }
+
+        /** @brief Check if an edge exists between two nodes (O(log deg)) */
+        auto has_edge(const Node& node_u, const Node& node_v) const -> bool {
+            return (*this)[node_u].contains(node_v);
+        }
+
+        /** @brief Access the neighbors of a node that are greater than it
+            @details O(1) with the upper offsets, O(log deg) without.
+            @param[in] node The node to look up
+            @return Read-only sorted view of the upper half of the row */
+        auto upper(const Node& node) const -> adjlist_t {
+            const auto* last = this->_nbrs + this->_offsets[node + 1];
+            if (this->_upper != nullptr) {
+                return adjlist_t{this->_nbrs + this->_upper[node], last};
+            }
+            return adjlist_t{
+                std::upper_bound(this->_nbrs + this->_offsets[node], last, node), last};
+        }
+
+        /** @brief Check if the upper offsets are stored (see upper()) */
+        auto has_upper_offsets() const -> bool { return this->_upper != nullptr; }
+
+        /** @brief Return a lazy view of all edges as (u, v) pairs
+            @details Each undirected edge is reported once with u < v, in
+            ascending (u, v) order, without allocating.
+            @return EdgeView over the edges */
+        auto edges() const -> EdgeView<CsrGraph> { return EdgeView<CsrGraph>{*this}; }
+
+        /** @brief Apply a callable to each edge (u, v) with u < v
+            @details Walks only the upper half of each row, so each edge is
+            visited once and no per-neighbor comparison is made.
+            @tparam F Callable `void(node_t, node_t)` or similar
+            @param[in] func Callable invoked for each edge */
+        template <typename F> auto for_each_edge(F&& func) const -> void {
+            for (const auto& node : this->_node) {
+                for (const auto& nbr : this->upper(node)) {
+                    std::forward<F>(func)(node, nbr);
+                }
+            }
+        }
+
+        /** @brief Row offsets array of size n + 1 */
+        auto offsets() const -> const offset_t* { return this->_offsets; }
+
+        /** @brief Upper offsets array of size n, or nullptr if not stored
+            @details `neighbors()[upper_offsets()[u] .. offsets()[u + 1])` are the
+            neighbors of u greater than u. */
+        auto upper_offsets() const -> const offset_t* { return this->_upper; }
+
+        /** @brief Concatenated neighbor array of size offsets()[n] */
+        auto neighbors() const -> const node_t* { return this->_nbrs; }
+
+        /** @brief Heap footprint of the arrays this graph reads (shared with its copies) */
+        auto memory_usage() const -> MemoryUsage {
+            const auto num_nodes = this->number_of_nodes();
+            MemoryUsage usage;
+            usage.outer_adjacency = (num_nodes + 1) * sizeof(offset_t);
+            usage.inner_adjacency = this->_offsets[num_nodes] * sizeof(node_t);
+            usage.other = this->_upper != nullptr ? num_nodes * sizeof(offset_t) : 0;
+            return usage;
+        }
+
+        /** @brief Check if the graph is a multigraph
+            @return false (this is a simple graph) */
+        auto is_multigraph() const { return false; }
+
+        /** @brief Check if the graph is directed
+            @return false (this is an undirected graph) */
+        auto is_directed() const { return false; }
+
+      private:
+        struct Arrays {
+            std::vector<offset_t> offsets;
+            std::vector<node_t> neighbors;
+            std::vector<offset_t> upper;
+            size_t num_edges;
+        };
+
+        static auto _make_arrays(std::vector<offset_t> offsets, std::vector<node_t> neighbors)
+            -> std::shared_ptr<const Arrays> {
+            assert(!offsets.empty() && offsets.front() == 0);
+            assert(offsets.back() == neighbors.size());
+            const auto num_nodes = offsets.size() - 1;
+            std::vector<offset_t> upper(num_nodes);
+            size_t num_edges = 0;
+            for (size_t node = 0; node != num_nodes; ++node) {
+                const auto first = neighbors.begin() + static_cast<ptrdiff_t>(offsets[node]);
+                const auto last = neighbors.begin() + static_cast<ptrdiff_t>(offsets[node + 1]);
+                // rows are sorted: entries >= node are the upper half (plus a self loop)
+                auto pos = std::lower_bound(first, last, static_cast<node_t>(node));
+                num_edges += static_cast<size_t>(last - pos);
+                if (pos != last && *pos == node) ++pos;
+                upper[node] = static_cast<offset_t>(pos - neighbors.begin());
+            }
+            return std::make_shared<const Arrays>(
+                Arrays{std::move(offsets), std::move(neighbors), std::move(upper), num_edges});
+        }
+
+        explicit CsrGraph(const std::shared_ptr<const Arrays>& arrays)
+            : _owner{arrays},
+              _offsets{arrays->offsets.data()},
+              _nbrs{arrays->neighbors.data()},
+              _upper{arrays->upper.data()},
+              _node{py::range<uint32_t>(static_cast<uint32_t>(arrays->offsets.size() - 1))},
+              _num_of_edges{arrays->num_edges} {}
+
+        std::shared_ptr<const void> _owner;
+        const offset_t* _offsets;
+        const node_t* _nbrs;
+        const offset_t* _upper = nullptr;
+        nodeview_t _node;
+        size_t _num_of_edges = 0;
+    };
+
+    /** @brief Take an immutable CSR snapshot of a graph with dense integer nodes
+        @details The graph's nodes must be 0 .. n-1 (as in SimpleGraph). Each
+        neighbor list is copied once and sorted. Removed (tombstoned) nodes
+        keep their ids and become isolated nodes of the snapshot.
+        @tparam Graph The source graph type
+        @param[in] gra The graph to freeze
+        @return CsrGraph with the same nodes and edges */
+    template <typename Graph> auto freeze(const Graph& gra) -> CsrGraph {
+        using offset_t = CsrGraph::offset_t;
+        using node_t = CsrGraph::node_t;
+
+        const auto num_nodes = gra.number_of_nodes();
+        std::vector<offset_t> offsets(num_nodes + 1, 0);
+        for (const auto& node : gra) {
+            offsets[static_cast<size_t>(node) + 1] = gra[node].size();
+        }
+        for (size_t idx = 0; idx != num_nodes; ++idx) {
+            offsets[idx + 1] += offsets[idx];
+        }
+
+        std::vector<node_t> neighbors(offsets[num_nodes]);
+        for (const auto& node : gra) {
+            auto first = neighbors.begin() + static_cast<ptrdiff_t>(offsets[node]);
+            auto last = std::copy(gra[node].begin(), gra[node].end(), first);
+            std::sort(first, last);
+        }
+        return CsrGraph{std::move(offsets), std::move(neighbors)};
+    }
+
+}  // namespace xnetwork
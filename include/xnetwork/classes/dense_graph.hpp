@@ -0,0 +1,336 @@
+/**
+ * @file dense_graph.hpp
+ * @brief Bitset adjacency-matrix representation of an undirected graph
+ *
+ * Defines the DenseGraph class, which stores one row of 64-bit words per
+ * node. It is meant for dense instances (complete graphs, TSP inputs) where
+ * hash-set adjacency wastes both memory and time.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <py2cpp/range.hpp>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/bit_ops.hpp>
+#include <xnetwork/classes/memory_usage.hpp>
+#include <xnetwork/classes/reportviews.hpp>
+#include <xnetwork/exception.hpp>
+
+namespace xnetwork {
+
+    /** @brief Read-only view of one adjacency-matrix row as a set of nodes
+        @details Iteration scans the row a word at a time and visits the set
+        bits in ascending order. */
+    class BitRow {
+      public:
+        using value_type = uint32_t;
+        using key_type = uint32_t;
+        using size_type = size_t;
+
+        /** @brief Forward iterator over the set bits of a row */
+        class const_iterator {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = uint32_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const uint32_t*;
+            using reference = const uint32_t&;
+
+            const_iterator(const uint64_t* words, size_t word_idx, size_t num_words)
+                : _words{words}, _word_idx{word_idx}, _num_words{num_words} {
+                if (this->_word_idx != this->_num_words) {
+                    this->_rest = this->_words[this->_word_idx];
+                    this->_advance();
+                }
+            }
+
+            auto operator*() const -> const uint32_t& { return this->_node; }
+
+            auto operator++() -> const_iterator& {
+                this->_rest &= this->_rest - 1;  // clear the lowest set bit
+                this->_advance();
+                return *this;
+            }
+
+            auto operator++(int) -> const_iterator {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            auto operator==(const const_iterator& other) const -> bool {
+                return this->_word_idx == other._word_idx && this->_rest == other._rest;
+            }
+
+            auto operator!=(const const_iterator& other) const -> bool {
+                return !(*this == other);
+            }
+
+          private:
+            auto _advance() -> void {
+                while (this->_rest == 0) {
+                    if (++this->_word_idx == this->_num_words) return;
+                    this->_rest = this->_words[this->_word_idx];
+                }
+                this->_node
+                    = static_cast<uint32_t>(this->_word_idx * 64 + detail::ctz64(this->_rest));
+            }
+
+            const uint64_t* _words;
+            size_t _word_idx;
+            size_t _num_words;
+            uint64_t _rest = 0;
+            uint32_t _node = 0;
+        };
+
+        using iterator = const_iterator;
+
+        /** @brief Construct a view over `num_words` words */
+        BitRow(const uint64_t* words, size_t num_words) : _words{words}, _num_words{num_words} {}
+
+        auto begin() const -> const_iterator { return {this->_words, 0, this->_num_words}; }
+
+        auto end() const -> const_iterator {
+            return {this->_words, this->_num_words, this->_num_words};
+        }
+
+        /** @brief Number of set bits (popcount over the row) */
+        auto size() const -> size_t {
+            size_t count = 0;
+            for (size_t idx = 0; idx != this->_num_words; ++idx) {
+                count += detail::popcount64(this->_words[idx]);
+            }
+            return count;
+        }
+
+        /** @brief Check if no bit is set */
+        auto empty() const -> bool {
+            return std::all_of(this->_words, this->_words + this->_num_words,
+                               [](uint64_t word) { return word == 0; });
+        }
+
+        /** @brief Check if a node's bit is set (O(1)) */
+        auto contains(uint32_t node) const -> bool {
+            return ((this->_words[node / 64] >> (node % 64)) & 1U) != 0;
+        }
+
+        /** @brief Pointer to the row's words */
+        auto data() const -> const uint64_t* { return this->_words; }
+
+      private:
+        const uint64_t* _words;
+        size_t _num_words;
+    };
+
+    /** @brief Undirected graph stored as a bitset adjacency matrix
+        @details Nodes are the dense integers 0 .. n-1. Row u holds bit v when
+        the edge (u, v) exists, so the graph takes n * ceil(n / 64) * 8 bytes
+        regardless of the number of edges. has_edge() is a single bit test,
+        degree() a popcount over the row, and neighbor iteration scans words
+        instead of chasing hash buckets. DenseGraph exposes the read surface of
+        SimpleGraph (`node_t`, `operator[]`, `for_each_edge`, `edges()`, ...) so
+        the templated algorithms can be instantiated on it. */
+    class DenseGraph {
+      public:
+        using node_t = uint32_t;
+        using Node = node_t;
+        using edge_t = std::pair<node_t, node_t>;
+        using nodeview_t = decltype(py::range<uint32_t>(uint32_t{}));
+        using adjlist_t = BitRow;
+        using key_type = node_t;
+        using value_type = node_t;
+
+        /** @brief Construct an edgeless graph with a given number of nodes
+            @param[in] num_nodes Number of nodes (0 to num_nodes-1) */
+        explicit DenseGraph(uint32_t num_nodes)
+            : _node{py::range<uint32_t>(num_nodes)},
+              _num_words{static_cast<size_t>(detail::words_for(num_nodes))},
+              _bits(size_t{num_nodes} * _num_words, 0) {}
+
+        /**
+         * @brief For compatible with BGL adaptor
+         *
+         * @param[in] e
+         * @return const edge_t&
+         */
+        static auto end_points(const edge_t& e) -> const edge_t& { return e; }
+
+        /** @brief Begin iterator over nodes */
+        auto begin() const { return std::begin(this->_node); }
+
+        /** @brief End iterator over nodes */
+        auto end() const { return std::end(this->_node); }
+
+        /** @brief Check if a node is in the graph */
+        auto contains(const Node& node) const -> bool { return this->_node.contains(node); }
+
+        /** @brief Check if the graph contains a node */
+        auto has_node(const Node& node) const -> bool { return this->_node.contains(node); }
+
+        /** @brief Access the adjacency row of a node
+            @param[in] node The node to look up
+            @return Read-only set view of the neighbors */
+        auto operator[](const Node& node) const -> adjlist_t {
+            return adjlist_t{this->_row(node), this->_num_words};
+        }
+
+        /** @brief Access the adjacency row of a node (same as operator[]) */
+        auto at(const Node& node) const -> adjlist_t {
+            assert(this->_node.contains(node));
+            return (*this)[node];
+        }
+
+        /** @brief Get the number of nodes in the graph */
+        auto number_of_nodes() const -> size_t { return this->_node.size(); }
+
+        /** @brief Get the number of nodes (same as number_of_nodes) */
+        auto order() const -> size_t { return this->_node.size(); }
+
+        /** @brief Get the number of nodes (same as number_of_nodes) */
+        auto size() const -> size_t { return this->_node.size(); }
+
+        /** @brief Get the number of undirected edges (O(1)) */
+        auto number_of_edges() const -> size_t { return this->_num_of_edges; }
+
+        /** @brief Get the degree of a node (popcount over the row) */
+        auto degree(const Node& node) const -> size_t { return (*this)[node].size(); }
+
+        /** @brief Check if an edge exists between two nodes (O(1)) */
+        auto has_edge(const Node& node_u, const Node& node_v) const -> bool {
+            return ((this->_row(node_u)[node_v / 64] >> (node_v % 64)) & 1U) != 0;
+        }
+
+        /** @brief Add an edge between two nodes
+            @details Adding an edge that already exists leaves the edge count unchanged.
+            @param[in] node_u First endpoint
+            @param[in] node_v Second endpoint */
+        auto add_edge(const Node& node_u, const Node& node_v) -> void {
+            if (this->has_edge(node_u, node_v)) return;
+            this->_row(node_u)[node_v / 64] |= uint64_t{1} << (node_v % 64);
+            this->_row(node_v)[node_u / 64] |= uint64_t{1} << (node_u % 64);
+            ++this->_num_of_edges;
+            ++this->_version;
+        }
+
+        /** @brief Add edges from a container of edge pairs
+            @tparam C1 Container type for edges
+            @param[in] edges Container of edge pairs */
+        template <typename C1> auto add_edges_from(const C1& edges) -> void {
+            for (const auto& e : edges) {
+                this->add_edge(e.first, e.second);
+            }
+        }
+
+        /** @brief Remove the edge between two nodes
+            @exception XNetworkError if there is no edge between node_u and node_v */
+        auto remove_edge(const Node& node_u, const Node& node_v) -> void {
+            if (!this->has_edge(node_u, node_v)) {
+                throw XNetworkError("remove_edge: the edge is not in the graph");
+            }
+            this->_row(node_u)[node_v / 64] &= ~(uint64_t{1} << (node_v % 64));
+            this->_row(node_v)[node_u / 64] &= ~(uint64_t{1} << (node_u % 64));
+            --this->_num_of_edges;
+            ++this->_version;
+        }
+
+        /** @brief Make the graph complete (every pair of distinct nodes adjacent)
+            @details Fills whole words at a time; O(n^2 / 64). */
+        auto add_all_edges() -> void {
+            const auto num_nodes = this->_node.size();
+            std::fill(this->_bits.begin(), this->_bits.end(), ~uint64_t{0});
+            const auto tail_bits = num_nodes % 64;
+            for (size_t node = 0; node != num_nodes; ++node) {
+                auto* row = this->_row(static_cast<node_t>(node));
+                if (tail_bits != 0) {
+                    row[this->_num_words - 1] = (uint64_t{1} << tail_bits) - 1;
+                }
+                row[node / 64] &= ~(uint64_t{1} << (node % 64));
+            }
+            this->_num_of_edges = num_nodes * (num_nodes - (num_nodes != 0 ? 1 : 0)) / 2;
+            ++this->_version;
+        }
+
+        /** @brief Return a lazy view of all edges as (u, v) pairs
+            @details Each undirected edge is reported once with u < v, in
+            ascending (u, v) order, without allocating.
+            @return EdgeView over the edges */
+        auto edges() const -> EdgeView<DenseGraph> { return EdgeView<DenseGraph>{*this}; }
+
+        /** @brief Apply a callable to each edge (u, v) with u < v
+            @details Scans only the upper triangle of the matrix.
+            @tparam F Callable `void(node_t, node_t)` or similar
+            @param[in] func Callable invoked for each edge */
+        template <typename F> auto for_each_edge(F&& func) const -> void {
+            for (const auto& node : this->_node) {
+                const auto* row = this->_row(node);
+                auto word_idx = static_cast<size_t>(node + 1) / 64;
+                if (word_idx >= this->_num_words) continue;
+                // mask off bits <= node in the first word
+                auto word = row[word_idx] & (~uint64_t{0} << ((node + 1) % 64));
+                while (true) {
+                    while (word != 0) {
+                        const auto nbr
+                            = static_cast<node_t>(word_idx * 64 + detail::ctz64(word));
+                        std::forward<F>(func)(node, nbr);
+                        word &= word - 1;
+                    }
+                    if (++word_idx == this->_num_words) break;
+                    word = row[word_idx];
+                }
+            }
+        }
+
+        /** @brief Remove all edges (the nodes are kept) */
+        auto clear() -> void {
+            std::fill(this->_bits.begin(), this->_bits.end(), 0);
+            this->_num_of_edges = 0;
+            ++this->_version;
+        }
+
+        /** @brief Cached degree array with histogram and degree ordering */
+        auto degree_view() const -> DegreeView<DenseGraph> { return DegreeView<DenseGraph>{*this}; }
+
+        /** @brief Heap footprint of the adjacency matrix */
+        auto memory_usage() const -> MemoryUsage {
+            MemoryUsage usage;
+            usage.inner_adjacency = detail::heap_bytes(this->_bits);
+            return usage;
+        }
+
+        /** @brief Counter bumped by every change to the edge set */
+        auto version() const -> size_t { return this->_version; }
+
+        /** @brief Number of 64-bit words per row */
+        auto words_per_row() const -> size_t { return this->_num_words; }
+
+        /** @brief Check if the graph is a multigraph
+            @return false (this is a simple graph) */
+        auto is_multigraph() const { return false; }
+
+        /** @brief Check if the graph is directed
+            @return false (this is an undirected graph) */
+        auto is_directed() const { return false; }
+
+      private:
+        auto _row(node_t node) const -> const uint64_t* {
+            return this->_bits.data() + size_t{node} * this->_num_words;
+        }
+
+        auto _row(node_t node) -> uint64_t* {
+            return this->_bits.data() + size_t{node} * this->_num_words;
+        }
+
+        nodeview_t _node;
+        size_t _num_words;
+        std::vector<uint64_t> _bits;
+        size_t _num_of_edges = 0;
+        size_t _version = 0;
+    };
+
+}  // namespace xnetwork
@@ -16,6 +16,7 @@
 #include <xnetwork/classes/coreviews.hpp>  // import AtlasView, AdjacencyView
 #include <xnetwork/classes/graph.hpp>
 #include <xnetwork/classes/reportviews.hpp>  // import NodeView, EdgeView, DegreeView
+#include <xnetwork/exception.hpp>
 
 // #if __cplusplus > 201703L
 // #include <cppcoro/generator.hpp>
@@ -27,13 +28,24 @@ namespace xnetwork {
         @details A DiGraphS stores nodes and edges with optional data or attributes.
         Directed edges are stored. Self loops are allowed but multiple (parallel) edges are not.
         Inherits from the undirected Graph base class.
+
+        The number of edges is cached, so number_of_edges() is O(1) as long as
+        edges are added through add_edge(). An optional predecessor index,
+        turned on with enable_predecessors(), is then kept in sync by add_edge()
+        and answers predecessors() and in_degree() without a reversed copy.
+        The removal functions keep both the counter and the index in sync.
         @tparam nodeview_t The node container type
         @tparam adjlist_t The adjacency list type
-        @tparam adjlist_outer_dict_factory The outer dict factory */
+        @tparam adjlist_outer_dict_factory The outer dict factory
+        @tparam pred_outer_dict_factory The outer dict factory of the predecessor index */
     template <typename nodeview_t, typename adjlist_t = py::dict<Value_type<nodeview_t>, int>,
-              typename adjlist_outer_dict_factory = py::dict<Value_type<nodeview_t>, adjlist_t>>
+              typename adjlist_outer_dict_factory = py::dict<Value_type<nodeview_t>, adjlist_t>,
+              typename pred_outer_dict_factory
+              = py::dict<Value_type<nodeview_t>, py::set<Value_type<nodeview_t>>>>
     class DiGraphS : public Graph<nodeview_t, adjlist_t, adjlist_outer_dict_factory> {
         using _Base = Graph<nodeview_t, adjlist_t, adjlist_outer_dict_factory>;
+        using predlist_t = std::decay_t<decltype(std::declval<pred_outer_dict_factory&>()[
+            std::declval<const Value_type<nodeview_t>&>()])>;
 
       public:
         using Node = typename _Base::Node;  // luk
@@ -46,6 +58,8 @@ namespace xnetwork {
 
       public:
         // adjlist_outer_dict_factory &_adj; // successor
+        pred_outer_dict_factory _pred{};  ///< Predecessor index (filled only when tracked)
+        bool _track_pred = false;         ///< Whether add_edge() maintains _pred
 
         /** @brief Construct a directed graph from a node container
             @param[in] Nodes Container of nodes */
@@ -55,6 +69,13 @@ namespace xnetwork {
             @param[in] num_nodes Number of nodes (0 to num_nodes-1) */
         explicit DiGraphS(uint32_t num_nodes) : _Base{num_nodes} {}
 
+        /** @brief Construct a directed graph with a given number of integer nodes whose
+            adjacency is allocated from `alloc` (e.g. a std::pmr arena)
+            @param[in] num_nodes Number of nodes (0 to num_nodes-1)
+            @param[in] alloc Allocator for the adjacency containers */
+        template <typename Alloc> DiGraphS(uint32_t num_nodes, const Alloc& alloc)
+            : _Base{num_nodes, alloc}, _pred(alloc) {}
+
         /** @brief Get adjacency mapping (successors) of the directed graph (const version) */
         auto adj() const {
             using T = decltype(this->_adj);
@@ -68,6 +89,43 @@ namespace xnetwork {
             return AdjacencyView<T>(this->_adj);
         }
 
+        /** @brief Get the predecessors mapping (requires enable_predecessors())
+            @return AdjacencyView of the predecessor index */
+        auto pred() const {
+            this->_check_pred();
+            using T = const decltype(this->_pred);
+            return AdjacencyView<T>(this->_pred);
+        }
+
+        /** @brief Build the predecessor index and keep it in sync from now on
+            @details Costs one O(V + E) pass; later add_edge() calls update the
+            index in O(1). Calling it again is a no-op. */
+        auto enable_predecessors() -> void {
+            if (this->_track_pred) return;
+            if constexpr (detail::is_resizable<pred_outer_dict_factory>::value) {
+                this->_pred.resize(this->_node.size());
+            }
+            for (const auto& node : this->_node) {
+                for (const auto& item : this->_adj[node]) {
+                    this->_pred[detail::adj_key(item)].insert(node);
+                }
+            }
+            this->_track_pred = true;
+        }
+
+        /** @brief Check if the predecessor index is maintained
+            @return true after enable_predecessors() */
+        auto has_predecessor_index() const -> bool { return this->_track_pred; }
+
+        /** @brief Estimated heap footprint; the predecessor index counts as `other` */
+        auto memory_usage() const -> MemoryUsage {
+            auto usage = _Base::memory_usage();
+            MemoryUsage pred;
+            detail::account_adjacency(this->_pred, pred);
+            usage.other += pred.outer_adjacency + pred.inner_adjacency;
+            return usage;
+        }
+
         /** Add an edge between node_u and node_v.
 
             The nodes node_u and node_v will be automatically added if (they are
@@ -118,7 +176,9 @@ namespace xnetwork {
             @param[in] node_v Target node */
         template <typename U = key_type> auto add_edge(const Node& node_u, const Node& node_v) ->
             typename std::enable_if<std::is_same<U, value_type>::value>::type {
-            this->_adj[node_u].insert(node_v);
+            if (this->_adj[node_u].insert(node_v).second) {
+                this->_on_new_edge(node_u, node_v);
+            }
         }
 
         /**
@@ -131,8 +191,9 @@ namespace xnetwork {
         template <typename U = key_type> auto add_edge(const Node& node_u, const Node& node_v) ->
             typename std::enable_if<!std::is_same<U, value_type>::value>::type {
             using T = typename adjlist_t::mapped_type;
-            auto data = this->_adj[node_u].get(node_v, T{});
-            this->_adj[node_u][node_v] = data;
+            if (this->_adj[node_u].contains(node_v)) return;
+            this->_adj[node_u][node_v] = T{};
+            this->_on_new_edge(node_u, node_v);
         }
 
         /**
@@ -144,9 +205,24 @@ namespace xnetwork {
          * @param data Edge data to associate with the edge
          */
         template <typename T> auto add_edge(const Node& node_u, const Node& node_v, const T& data) {
+            if (!this->_adj[node_u].contains(node_v)) {
+                this->_on_new_edge(node_u, node_v);
+            }
             this->_adj[node_u][node_v] = data;
         }
 
+        /**
+         * @brief Add edges from a container of edge pairs
+         *
+         * @tparam C1 Container type for edges
+         * @param edges Container of edge pairs
+         */
+        template <typename C1> auto add_edges_from(const C1& edges) {
+            for (const auto& e : edges) {
+                this->add_edge(e.first, e.second);
+            }
+        }
+
         /**
          * @brief Add edges from a container with associated data
          *
@@ -163,6 +239,97 @@ namespace xnetwork {
             }
         }
 
+        /** @brief Remove the directed edge u -> v
+            @param[in] node_u Source node
+            @param[in] node_v Target node
+            @exception XNetworkError if there is no edge u -> v */
+        auto remove_edge(const Node& node_u, const Node& node_v) -> void {
+            if (!this->_remove_edge(node_u, node_v)) {
+                throw XNetworkError("remove_edge: the edge is not in the graph");
+            }
+        }
+
+        /** @brief Remove directed edges from a container of edge pairs
+            @details Edges that are not in the graph are silently ignored.
+            @tparam C1 Container type for edges
+            @param[in] edges Container of edge pairs */
+        template <typename C1> auto remove_edges_from(const C1& edges) -> void {
+            for (const auto& e : edges) {
+                this->_remove_edge(e.first, e.second);
+            }
+        }
+
+        /** @brief Remove a node and all its incoming and outgoing edges
+            @details O(in + out degree) with the predecessor index; without it
+            the incoming edges are found by an O(V) scan. The node is tombstoned
+            as in Graph::remove_node().
+            @param[in] node The node to remove
+            @exception XNetworkError if the node is not in the graph */
+        auto remove_node(const Node& node) -> void {
+            if (!this->has_node(node)) {
+                throw XNetworkError("remove_node: the node is not in the graph");
+            }
+            auto& succs = this->_adj[node];
+            if (this->_track_pred) {
+                for (const auto& item : succs) {
+                    this->_pred[detail::adj_key(item)].erase(node);
+                }
+            }
+            this->_num_of_edges -= succs.size();
+            succs.clear();
+            if (this->_track_pred) {
+                auto& preds = this->_pred[node];
+                for (const auto& pred : preds) {
+                    this->_adj[pred].erase(node);
+                }
+                this->_num_of_edges -= preds.size();
+                preds.clear();
+            } else {
+                for (const auto& other : this->_node) {
+                    this->_num_of_edges -= this->_adj[other].erase(node);
+                }
+            }
+            this->_tombstones.insert(node);
+            ++this->_version;
+        }
+
+        /** @brief Remove nodes from a container, ignoring nodes not in the graph
+            @tparam C1 Container type for nodes
+            @param[in] nodes Container of nodes */
+        template <typename C1> auto remove_nodes_from(const C1& nodes) -> void {
+            for (const auto& node : nodes) {
+                if (this->has_node(node)) {
+                    this->remove_node(node);
+                }
+            }
+        }
+
+        /** @brief Renumber the surviving nodes densely, dropping tombstones
+            @details See Graph::compact(); the predecessor index, if enabled, is
+            rebuilt for the new ids.
+            @return Mapping from each new node id to its old id */
+        auto compact() -> std::vector<Node> {
+            auto new_to_old = _Base::compact();
+            if (this->_track_pred) {
+                this->_pred.clear();
+                this->_track_pred = false;
+                this->enable_predecessors();
+            }
+            return new_to_old;
+        }
+
+        /** @brief Append an isolated node with the next free integer id
+            @details See Graph::append_node(); the predecessor index, if
+            enabled, grows with it.
+            @return The id of the new node */
+        auto append_node() -> Node {
+            const auto node = _Base::append_node();
+            if (this->_track_pred) {
+                this->_pred.emplace_back();
+            }
+            return node;
+        }
+
         /** @brief Check if a node has a specific successor
             @param[in] node_u Source node
             @param[in] node_v Potential successor node
@@ -181,28 +348,57 @@ namespace xnetwork {
             @return Const reference to the adjacency list of the node */
         auto successors(const Node& node) const -> const auto& { return this->_adj[node]; }
 
+        /** @brief Check if a node has a specific predecessor (requires enable_predecessors())
+            @param[in] node_u Target node
+            @param[in] node_v Potential predecessor node
+            @return true if the edge v->u exists */
+        auto has_predecessor(const Node& node_u, const Node& node_v) const -> bool {
+            return this->predecessors(node_u).contains(node_v);
+        }
+
+        /** @brief Get the predecessors of a node (requires enable_predecessors())
+            @param[in] node The node to get predecessors for
+            @return Const reference to the set of nodes with an edge into `node` */
+        auto predecessors(const Node& node) const -> const predlist_t& {
+            this->_check_pred();
+            if constexpr (detail::is_resizable<pred_outer_dict_factory>::value) {
+                return this->_pred[node];
+            } else {
+                static const predlist_t no_preds{};
+                const auto it = this->_pred.find(node);
+                return it == this->_pred.end() ? no_preds : it->second;
+            }
+        }
+
         /** @brief Get the out-degree of a node in the directed graph
             @param[in] node The node to get the degree for
             @return The number of outgoing edges from the node */
         auto degree(const Node& node) const { return this->_adj[node].size(); }
 
-        /** @brief Get the number of edges in the directed graph
-            @details Iterates through the adjacency structure to count edges.
-            @return Number of edges */
-        auto number_of_edges() const -> size_t {
-            size_t n_edges = 0;
-            for (const auto& node : this->_node) {
-                n_edges += this->_adj.at(node).size();
-            }
-            return n_edges;  // No division needed since it's a directed graph
+        /** @brief Get the out-degree of a node (same as degree) */
+        auto out_degree(const Node& node) const { return this->_adj[node].size(); }
+
+        /** @brief Get the in-degree of a node (requires enable_predecessors())
+            @param[in] node The node to get the in-degree for
+            @return The number of incoming edges to the node */
+        auto in_degree(const Node& node) const -> size_t {
+            return this->predecessors(node).size();
         }
 
-        /** @brief Remove all nodes and edges from the graph */
+        /** @brief Get the number of edges in the directed graph
+            @return Number of edges (cached value, O(1)) */
+        auto number_of_edges() const -> size_t { return this->_num_of_edges; }
+
+        /** @brief Remove all edges from the graph
+            @details With vector adjacency the nodes 0 .. n-1 stay and keep
+            their (now empty) rows; otherwise the adjacency is emptied. An
+            enabled predecessor index stays enabled and is emptied the same way. */
         auto clear() {
-            this->_adj.clear();
-            // this->_pred.clear()
-            // this->_node.clear();
-            this->graph.clear();
+            detail::clear_adjacency(this->_adj);
+            detail::clear_adjacency(this->_pred);
+            this->_num_of_edges = 0;
+            this->_tombstones.clear();
+            ++this->_version;
         }
 
         /** @brief Check if the graph is a multigraph
@@ -212,13 +408,38 @@ namespace xnetwork {
         /** @brief Check if the graph is directed
             @return true (this is a directed graph) */
         auto is_directed() const { return true; }
+
+      private:
+        auto _remove_edge(const Node& node_u, const Node& node_v) -> bool {
+            if (this->_adj[node_u].erase(node_v) == 0) return false;
+            if (this->_track_pred) {
+                this->_pred[node_v].erase(node_u);
+            }
+            --this->_num_of_edges;
+            ++this->_version;
+            return true;
+        }
+
+        auto _on_new_edge(const Node& node_u, const Node& node_v) -> void {
+            _Base::_on_new_edge(node_u, node_v);
+            if (this->_track_pred) {
+                this->_pred[node_v].insert(node_u);
+            }
+        }
+
+        auto _check_pred() const -> void {
+            if (!this->_track_pred) {
+                throw XNetworkError("predecessor index not enabled; call enable_predecessors()");
+            }
+        }
     };
 
     /** @brief A simple directed graph with integer nodes
         @details Convenience alias for a DiGraphS with uint32_t nodes and vector-based adjacency
        storage */
-    using SimpleDiGraphS = DiGraphS<decltype(py::range<uint32_t>(uint32_t{})),
-                                    py::dict<uint32_t, int>, std::vector<py::dict<uint32_t, int>>>;
+    using SimpleDiGraphS
+        = DiGraphS<decltype(py::range<uint32_t>(uint32_t{})), py::dict<uint32_t, int>,
+                   std::vector<py::dict<uint32_t, int>>, std::vector<py::set<uint32_t>>>;
 
     // template <typename nodeview_t,
     //           typename adjlist_t> DiGraphS(int )
@@ -0,0 +1,191 @@
+/**
+ * @file edge_index.hpp
+ * @brief Stable edge ids and edge-id-addressed attribute columns
+ *
+ * EdgeIndex numbers the undirected edges of a CSR graph 0 .. m-1 in
+ * ascending (u, v) order with u <= v, and records the id of every arc in an
+ * array aligned with CsrGraph::neighbors(). Edge attributes then live in
+ * plain contiguous columns (EdgeWeights) indexed by that id, one column per
+ * attribute, instead of being recomputed by a callable or looked up in a
+ * per-node hash map.
+ *
+ * An EdgeWeights column is itself a callable ``weight(u, v)``, so it can be
+ * passed to every algorithm that takes a weight function. Kernels that walk
+ * the adjacency read the weight of the arc at position `pos` of neighbors()
+ * with a single indexed load via at_arc(pos), and kernels that know the edge
+ * id read it with operator[]; solve_hadlock_max_cut() takes the latter path
+ * when given a column.
+ *
+ * Only undirected graphs are indexed: EdgeIndex requires a symmetric CSR
+ * graph, so DiGraphS arcs have no edge ids and its weights stay callables.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/exception.hpp>
+
+namespace xnetwork {
+
+    /** @brief Stable ids for the undirected edges of a CsrGraph
+        @details Ids depend only on the edge set, so two indexes over the same
+        edges agree. The graph and the id arrays are shared between copies, so
+        copying an index is O(1). */
+    class EdgeIndex {
+      public:
+        using node_t = CsrGraph::node_t;
+        using edge_id_t = CsrGraph::offset_t;
+        using edge_t = std::pair<node_t, node_t>;
+
+        /** @brief Number the edges of a CSR graph (O(n + m)) */
+        explicit EdgeIndex(CsrGraph gra) : _gra{std::move(gra)} {
+            const auto num_nodes = this->_gra.number_of_nodes();
+            const auto* offsets = this->_gra.offsets();
+            const auto* nbrs = this->_gra.neighbors();
+            auto arrays = std::make_shared<Arrays>();
+            arrays->arc_edge.resize(offsets[num_nodes]);
+            arrays->source.reserve(this->_gra.number_of_edges());
+            arrays->target.reserve(this->_gra.number_of_edges());
+
+            // rows are sorted and visited in ascending u, so the lower arcs
+            // (v, u) of each row v are met in order: fill them with a cursor
+            std::vector<edge_id_t> lower(offsets, offsets + num_nodes);
+            for (node_t utx = 0; utx != num_nodes; ++utx) {
+                for (auto pos = offsets[utx]; pos != offsets[utx + 1]; ++pos) {
+                    const auto vtx = nbrs[pos];
+                    if (vtx < utx) continue;
+                    const auto eid = static_cast<edge_id_t>(arrays->source.size());
+                    arrays->source.push_back(utx);
+                    arrays->target.push_back(vtx);
+                    arrays->arc_edge[pos] = eid;
+                    if (vtx != utx) {
+                        arrays->arc_edge[lower[vtx]++] = eid;
+                    }
+                }
+            }
+            this->_arrays = std::move(arrays);
+        }
+
+        /** @brief Number the edges of an undirected graph with dense integer nodes (via
+            freeze()) */
+        template <typename Graph> static auto of(const Graph& gra) -> EdgeIndex {
+            return EdgeIndex{freeze(gra)};
+        }
+
+        /** @brief The indexed graph */
+        auto graph() const -> const CsrGraph& { return this->_gra; }
+
+        /** @brief Number of edges m; ids are 0 .. m-1 */
+        auto number_of_edges() const -> size_t { return this->_arrays->source.size(); }
+
+        /** @brief Id of edge (u, v) or (v, u) (O(log deg))
+            @exception XNetworkError if the edge does not exist */
+        auto edge_id(node_t node_u, node_t node_v) const -> edge_id_t {
+            const auto nbrs = this->_gra[node_u];
+            const auto* pos = std::lower_bound(nbrs.begin(), nbrs.end(), node_v);
+            if (pos == nbrs.end() || *pos != node_v) {
+                throw XNetworkError("edge_id: no such edge");
+            }
+            return this->_arrays->arc_edge[static_cast<size_t>(pos - this->_gra.neighbors())];
+        }
+
+        /** @brief Smaller endpoint of an edge */
+        auto source(edge_id_t eid) const -> node_t { return this->_arrays->source[eid]; }
+
+        /** @brief Larger endpoint of an edge */
+        auto target(edge_id_t eid) const -> node_t { return this->_arrays->target[eid]; }
+
+        /** @brief Both endpoints of an edge, smaller first */
+        auto end_points(edge_id_t eid) const -> edge_t {
+            return {this->_arrays->source[eid], this->_arrays->target[eid]};
+        }
+
+        /** @brief Edge id of every arc, aligned with graph().neighbors() */
+        auto arc_edge_ids() const -> const edge_id_t* { return this->_arrays->arc_edge.data(); }
+
+        /** @brief Apply a callable to each edge as (u, v, id), u <= v, in id order
+            @tparam F Callable `void(node_t, node_t, edge_id_t)` */
+        template <typename F> auto for_each_edge(F&& func) const -> void {
+            const auto& source = this->_arrays->source;
+            const auto& target = this->_arrays->target;
+            for (edge_id_t eid = 0; eid != source.size(); ++eid) {
+                func(source[eid], target[eid], eid);
+            }
+        }
+
+      private:
+        struct Arrays {
+            std::vector<edge_id_t> arc_edge;
+            std::vector<node_t> source;
+            std::vector<node_t> target;
+        };
+
+        CsrGraph _gra;
+        std::shared_ptr<const Arrays> _arrays;
+    };
+
+    /** @brief Contiguous column of one attribute per edge, addressed by edge id
+        @details The column holds a copy of its EdgeIndex (O(1), the arrays are
+        shared), so it stays valid when built from a temporary index.
+        @tparam T The attribute type */
+    template <typename T> class EdgeWeights {
+      public:
+        using node_t = EdgeIndex::node_t;
+        using edge_id_t = EdgeIndex::edge_id_t;
+        using value_type = T;
+
+        /** @brief Column with every edge set to `init` */
+        explicit EdgeWeights(const EdgeIndex& index, T init = T{})
+            : _index{index}, _data(index.number_of_edges(), init) {}
+
+        /** @brief Column with edge (u, v) set to func(u, v), e.g. to convert a
+            weight callable once; func is queried once per edge with u <= v
+            @tparam F Callable `T(node_t, node_t)` */
+        template <typename F> static auto from(const EdgeIndex& index, F&& func) -> EdgeWeights {
+            EdgeWeights column{index};
+            index.for_each_edge([&](node_t utx, node_t vtx, edge_id_t eid) {
+                column._data[eid] = func(utx, vtx);
+            });
+            return column;
+        }
+
+        /** @brief Weight of an edge by id */
+        auto operator[](edge_id_t eid) const -> const T& { return this->_data[eid]; }
+
+        /** @brief Mutable weight of an edge by id */
+        auto operator[](edge_id_t eid) -> T& { return this->_data[eid]; }
+
+        /** @brief Weight of the arc at position `pos` of graph().neighbors() */
+        auto at_arc(edge_id_t pos) const -> const T& {
+            return this->_data[this->_index.arc_edge_ids()[pos]];
+        }
+
+        /** @brief Weight of edge (u, v); makes the column usable as a weight function
+            @details Finds the edge id by a binary search of row u (O(log deg));
+            kernels that know the edge id or the arc position should use
+            operator[] or at_arc() instead. */
+        auto operator()(node_t node_u, node_t node_v) const -> T {
+            return this->_data[this->_index.edge_id(node_u, node_v)];
+        }
+
+        /** @brief The index the column is addressed by */
+        auto index() const -> const EdgeIndex& { return this->_index; }
+
+        /** @brief Number of entries (== number of edges) */
+        auto size() const -> size_t { return this->_data.size(); }
+
+        /** @brief Raw column data */
+        auto data() const -> const T* { return this->_data.data(); }
+
+      private:
+        EdgeIndex _index;
+        std::vector<T> _data;
+    };
+
+}  // namespace xnetwork
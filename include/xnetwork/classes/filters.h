@@ -12,6 +12,7 @@
 
 // #include <functional>
 #include <set>
+#include <xnetwork/classes/node_bitset.hpp>
 
 /** Filter factories to hide || show sets of nodes && edges.
 
@@ -56,6 +57,26 @@ template <typename T> auto hide_nodes(const std::set<T>& nodes) {
     return [nodes](const T& node) { return nodes.find(node) == nodes.end(); };
 }
 
+/**
+ * @brief Create a filter that hides the nodes of a bitset (a bit test per call)
+ *
+ * @param nodes The nodes to hide
+ * @return auto A predicate function that accepts a node and returns true if not hidden
+ */
+inline auto hide_nodes(const xnetwork::NodeBitset& nodes) {
+    return [nodes](uint32_t node) { return !nodes.contains(node); };
+}
+
+/**
+ * @brief Create a filter that shows only the nodes of a bitset (a bit test per call)
+ *
+ * @param nodes The nodes to show
+ * @return auto A predicate function that accepts a node and returns true if shown
+ */
+inline auto show_nodes(const xnetwork::NodeBitset& nodes) {
+    return [nodes](uint32_t node) { return nodes.contains(node); };
+}
+
 /**
  * @brief Create a filter that hides specified directed edges
  *
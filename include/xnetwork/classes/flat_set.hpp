@@ -0,0 +1,201 @@
+/**
+ * @file flat_set.hpp
+ * @brief Sorted flat-vector set, usable as the adjacency list type of Graph
+ *
+ * Defines the flat_set class template, merge-based helpers for sorted
+ * neighbor ranges, and FlatSimpleGraph, a SimpleGraph whose adjacency lists
+ * are sorted contiguous vectors instead of hash sets.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <py2cpp/range.hpp>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/graph.hpp>
+
+namespace xnetwork {
+
+    /** @brief Set of keys kept sorted in one contiguous vector
+        @details Lookups in small sets use a branch-free linear scan, which
+        compilers vectorize and which stays within one or two cache lines for
+        typical sparse-graph degrees; larger sets use binary search. Inserting
+        keys in ascending order (as GraphBuilder does) is an amortized O(1)
+        append; other inserts shift the tail of the vector.
+
+        Provides the subset of the py::set interface that Graph relies on, so
+        it can be plugged in as `adjlist_t`.
+        @tparam Key The element type (totally ordered) */
+    template <typename Key> class flat_set {
+      public:
+        using key_type = Key;
+        using value_type = Key;
+        using size_type = size_t;
+        using const_iterator = typename std::vector<Key>::const_iterator;
+        using iterator = const_iterator;
+
+        /** @brief Sets up to this size are searched linearly */
+        static constexpr size_t linear_search_limit = 32;
+
+        /** @brief Construct an empty set */
+        flat_set() = default;
+
+        /** @brief Construct a set from a list of keys (in any order, duplicates allowed) */
+        flat_set(std::initializer_list<Key> keys) : _keys(keys) { this->_normalize(); }
+
+        /** @brief Iterator to the smallest key */
+        auto begin() const -> const_iterator { return this->_keys.begin(); }
+
+        /** @brief Iterator past the largest key */
+        auto end() const -> const_iterator { return this->_keys.end(); }
+
+        /** @brief Number of keys */
+        auto size() const -> size_t { return this->_keys.size(); }
+
+        /** @brief Number of keys the storage can hold without reallocating */
+        auto capacity() const -> size_t { return this->_keys.capacity(); }
+
+        /** @brief Check if the set is empty */
+        auto empty() const -> bool { return this->_keys.empty(); }
+
+        /** @brief Pointer to the sorted keys */
+        auto data() const -> const Key* { return this->_keys.data(); }
+
+        /** @brief Reserve space for a number of keys */
+        auto reserve(size_t capacity) -> void { this->_keys.reserve(capacity); }
+
+        /** @brief Remove all keys (capacity is kept) */
+        auto clear() -> void { this->_keys.clear(); }
+
+        /** @brief Check if a key is in the set
+            @param[in] key The key to look up
+            @return true if key is present */
+        auto contains(const Key& key) const -> bool {
+            if (this->_keys.size() <= linear_search_limit) {
+                bool found = false;
+                for (const auto& item : this->_keys) {
+                    found |= (item == key);
+                }
+                return found;
+            }
+            return std::binary_search(this->_keys.begin(), this->_keys.end(), key);
+        }
+
+        /** @brief Number of occurrences of a key (0 or 1) */
+        auto count(const Key& key) const -> size_t { return this->contains(key) ? 1 : 0; }
+
+        /** @brief Find a key
+            @return Iterator to the key, or end() if absent */
+        auto find(const Key& key) const -> const_iterator {
+            const auto it = std::lower_bound(this->_keys.begin(), this->_keys.end(), key);
+            return (it != this->_keys.end() && *it == key) ? it : this->_keys.end();
+        }
+
+        /** @brief Insert a key
+            @param[in] key The key to insert
+            @return Iterator to the key and whether it was inserted */
+        auto insert(const Key& key) -> std::pair<const_iterator, bool> {
+            if (this->_keys.empty() || this->_keys.back() < key) {
+                this->_keys.push_back(key);
+                return {std::prev(this->_keys.end()), true};
+            }
+            const auto it = std::lower_bound(this->_keys.begin(), this->_keys.end(), key);
+            if (*it == key) {
+                return {it, false};
+            }
+            return {this->_keys.insert(it, key), true};
+        }
+
+        /** @brief Insert a range of keys
+            @details Costs O((n + m) log m) for m new keys in any order, or
+            O(n + m) when they arrive sorted. */
+        template <typename InputIt> auto insert(InputIt first, InputIt last) -> void {
+            const auto old_size = static_cast<std::ptrdiff_t>(this->_keys.size());
+            this->_keys.insert(this->_keys.end(), first, last);
+            const auto mid = this->_keys.begin() + old_size;
+            if (!std::is_sorted(mid, this->_keys.end())) {
+                std::sort(mid, this->_keys.end());
+            }
+            std::inplace_merge(this->_keys.begin(), mid, this->_keys.end());
+            this->_keys.erase(std::unique(this->_keys.begin(), this->_keys.end()),
+                              this->_keys.end());
+        }
+
+        /** @brief Remove a key
+            @return Number of keys removed (0 or 1) */
+        auto erase(const Key& key) -> size_t {
+            const auto it = std::lower_bound(this->_keys.begin(), this->_keys.end(), key);
+            if (it == this->_keys.end() || *it != key) {
+                return 0;
+            }
+            this->_keys.erase(it);
+            return 1;
+        }
+
+        /** @brief Return a copy of the set */
+        auto copy() const -> flat_set { return *this; }
+
+        friend auto operator==(const flat_set& lhs, const flat_set& rhs) -> bool {
+            return lhs._keys == rhs._keys;
+        }
+
+        friend auto operator!=(const flat_set& lhs, const flat_set& rhs) -> bool {
+            return !(lhs == rhs);
+        }
+
+      private:
+        auto _normalize() -> void {
+            std::sort(this->_keys.begin(), this->_keys.end());
+            this->_keys.erase(std::unique(this->_keys.begin(), this->_keys.end()),
+                              this->_keys.end());
+        }
+
+        std::vector<Key> _keys{};
+    };
+
+    /** @brief Apply a callable to every key common to two sorted ranges (merge, O(m + n))
+        @tparam R1 Sorted range type (flat_set, CsrNeighbors, ...)
+        @tparam R2 Sorted range type
+        @tparam F Callable `void(const Key&)`
+        @param[in] lhs First sorted range
+        @param[in] rhs Second sorted range
+        @param[in] func Callable invoked for each common key in ascending order */
+    template <typename R1, typename R2, typename F>
+    auto for_each_common(const R1& lhs, const R2& rhs, F&& func) -> void {
+        auto it1 = lhs.begin();
+        auto it2 = rhs.begin();
+        while (it1 != lhs.end() && it2 != rhs.end()) {
+            if (*it1 < *it2) {
+                ++it1;
+            } else if (*it2 < *it1) {
+                ++it2;
+            } else {
+                std::invoke(func, *it1);
+                ++it1;
+                ++it2;
+            }
+        }
+    }
+
+    /** @brief Number of keys common to two sorted ranges (merge, O(m + n))
+        @param[in] lhs First sorted range
+        @param[in] rhs Second sorted range
+        @return Size of the intersection */
+    template <typename R1, typename R2>
+    auto intersection_size(const R1& lhs, const R2& rhs) -> size_t {
+        size_t count = 0;
+        for_each_common(lhs, rhs, [&count](const auto&) { ++count; });
+        return count;
+    }
+
+    /** @brief A simple undirected graph with integer nodes and sorted flat adjacency lists */
+    using FlatSimpleGraph = Graph<decltype(py::range<uint32_t>(uint32_t{})), flat_set<uint32_t>,
+                                  std::vector<flat_set<uint32_t>>>;
+
+}  // namespace xnetwork
@@ -12,20 +12,74 @@
 #include <cstdint>
 #include <py2cpp/py2cpp.hpp>
 #include <type_traits>
+#include <utility>
 #include <vector>
 #include <xnetwork/classes/coreviews.hpp>    // import AtlasView, AdjacencyView
+#include <xnetwork/classes/memory_usage.hpp>
 #include <xnetwork/classes/reportviews.hpp>  // import NodeView, EdgeView, DegreeView
+#include <xnetwork/exception.hpp>
 
 /** @brief Alias for the value_type of a container */
 template <typename T> using Value_type = typename T::value_type;
 
 namespace xnetwork {
 
+    namespace detail {
+
+        /** @brief Neighbor key of an adjacency element: the key of a (key, data) pair */
+        template <typename K, typename V> auto adj_key(const std::pair<const K, V>& item)
+            -> const K& {
+            return item.first;
+        }
+
+        /** @brief Neighbor key of an adjacency element: the element of a set */
+        template <typename K> auto adj_key(const K& item) -> const K& { return item; }
+
+        /** @brief Adjacency element with its neighbor key mapped through `func` */
+        template <typename K, typename V, typename F>
+        auto relabel_item(const std::pair<const K, V>& item, F&& func) -> std::pair<K, V> {
+            return {func(item.first), item.second};
+        }
+
+        /** @brief Set element mapped through `func` */
+        template <typename K, typename F> auto relabel_item(const K& item, F&& func) -> K {
+            return func(item);
+        }
+
+        /** @brief Whether an outer adjacency container is indexed by position (vector-like) */
+        template <typename T, typename = void> struct is_resizable : std::false_type {};
+
+        template <typename T>
+        struct is_resizable<T, std::void_t<decltype(std::declval<T&>().resize(size_t{}))>>
+            : std::true_type {};
+
+        /** @brief Drop every edge of an outer adjacency container; vector rows
+            are emptied in place so that node ids stay valid indices */
+        template <typename T> auto clear_adjacency(T& adj) -> void {
+            if constexpr (is_resizable<T>::value) {
+                for (auto& row : adj) {
+                    row.clear();
+                }
+            } else {
+                adj.clear();
+            }
+        }
+
+    }  // namespace detail
+
     /** @brief Undirected graph with arbitrary node types
         @details A Graph stores nodes and edges with optional data or attributes.
         Graphs hold undirected edges. Self loops are allowed but multiple
         (parallel) edges are not. Nodes can be arbitrary (hashable) C++ objects.
 
+        Edges and nodes can be removed in time proportional to the change.
+        Because the node container may be an immutable range, a removed node
+        is isolated and tombstoned: it is no longer reported by has_node() or
+        number_of_live_nodes(), but node iteration still visits it (with no
+        neighbors) and number_of_nodes() still counts its id until compact()
+        renumbers the remaining nodes. Adding an edge at a tombstoned node
+        brings the node back.
+
         The Graph class uses a container-of-container-of-container data structure.
         The outer dict (node_dict) holds adjacency information keyed by node.
         The next dict (adjlist_dict) represents the adjacency information and holds
@@ -58,12 +112,14 @@ namespace xnetwork {
         using node_t = Node;
 
         size_t _num_of_edges = 0;  ///< Number of edges in the graph (cached)
+        size_t _version = 0;       ///< Bumped by every change made through the methods
 
         // std::vector<Node > _Nodes{}
         nodeview_t _node;  ///< Container holding all nodes in the graph
         // graph_attr_dict_factory graph{};  // dictionary for graph attributes
         // node_dict_factory _node{};  // empty node attribute dict
         adjlist_outer_dict_factory _adj;  ///< Adjacency dictionary keyed by node
+        py::set<Node> _tombstones{};      ///< Removed nodes still held by _node
 
         // auto __getstate__() {
         //     attr = this->__dict__.copy();
@@ -94,6 +150,14 @@ namespace xnetwork {
               _adj(num_nodes)  // std::vector
         {}
 
+        /** @brief Construct a graph with a given number of integer nodes whose
+            adjacency is allocated from `alloc` (e.g. a std::pmr arena)
+            @tparam Alloc Allocator type convertible to the adjacency allocator
+            @param[in] num_nodes Number of nodes (0 to num_nodes-1)
+            @param[in] alloc Allocator for the outer and inner adjacency containers */
+        template <typename Alloc> Graph(uint32_t num_nodes, const Alloc& alloc)
+            : _node{py::range<uint32_t>(num_nodes)}, _adj(num_nodes, alloc) {}
+
         // Graph(const Graph&) = delete;            // don't copy
         // Graph& operator=(const Graph&) = delete; // don't copy
         // Graph(Graph&&) noexcept = default;
@@ -172,7 +236,7 @@ namespace xnetwork {
         /** @brief Check if a node is in the graph
             @param[in] node The node to check
             @return true if the node exists, false otherwise */
-        auto contains(const Node& node) const -> bool { return this->_node.contains(node); }
+        auto contains(const Node& node) const -> bool { return this->has_node(node); }
 
         /** @brief Access adjacency dict of a node (const version)
             @param[in] node The node to look up
@@ -202,50 +266,55 @@ namespace xnetwork {
         }
 
         /** @brief Get the number of nodes in the graph
+            @details Tombstoned nodes are included, so that integer node ids
+            stay in 0 .. number_of_nodes()-1 for algorithms that index arrays
+            by node.
             @return Number of nodes */
         auto number_of_nodes() const -> size_t { return this->_node.size(); }
 
+        /** @brief Get the number of nodes that have not been removed
+            @return Number of nodes minus the number of tombstones */
+        auto number_of_live_nodes() const -> size_t {
+            return this->_node.size() - this->_tombstones.size();
+        }
+
         /** @brief Get the number of nodes (same as number_of_nodes)
             @return Number of nodes */
-        auto order() const { return this->_node.size(); }
+        auto order() const -> size_t { return this->number_of_nodes(); }
 
         /** @brief Get the number of nodes (same as number_of_nodes)
             @return Number of nodes */
-        auto size() const -> size_t { return this->_node.size(); }
+        auto size() const -> size_t { return this->number_of_nodes(); }
 
         /** @brief Get the number of edges in the graph
             @return Number of edges (cached value, O(1)) */
         auto number_of_edges() const -> size_t { return this->_num_of_edges; }
 
-        /** @brief Return a vector of all edges as (u, v) pairs
-            @details Each undirected edge is reported once with u < v.
-            @return Vector of (u, v) pairs representing all edges */
-        auto edges() const -> std::vector<edge_t> {
-            std::vector<edge_t> result;
-            for (const auto& node : this->_node) {
-                for (const auto& nbr : this->_adj[node]) {
-                    if (node < nbr) {
-                        result.emplace_back(node, nbr);
-                    }
-                }
-            }
-            return result;
-        }
+        /** @brief Return a lazy view of all edges as (u, v) pairs
+            @details Each undirected edge is reported once with u < v. The view
+            walks the adjacency on demand and allocates nothing.
+            @return EdgeView over the edges */
+        auto edges() const -> EdgeView<Graph> { return EdgeView<Graph>{*this}; }
 
         /** @brief Check if the graph contains a node
             @param[in] node The node to check
             @return true if the node exists, false otherwise */
-        auto has_node(const Node& node) const -> bool { return this->_node.contains(node); }
+        auto has_node(const Node& node) const -> bool {
+            return this->_node.contains(node)
+                   && (this->_tombstones.empty() || !this->_tombstones.contains(node));
+        }
 
         /** @brief Add an edge between two nodes (for simple key type, SFINAE)
+            @details Adding an edge that already exists leaves the edge count unchanged.
             @tparam U Key type parameter for SFINAE dispatch
             @param[in] node_u First endpoint of the edge
             @param[in] node_v Second endpoint of the edge */
         template <typename U = key_type> auto add_edge(const Node& node_u, const Node& node_v) ->
             typename std::enable_if<std::is_same<U, value_type>::value>::type {
-            this->_adj[node_u].insert(node_v);
-            this->_adj[node_v].insert(node_u);
-            ++this->_num_of_edges;
+            if (this->_adj[node_u].insert(node_v).second) {
+                this->_adj[node_v].insert(node_u);
+                this->_on_new_edge(node_u, node_v);
+            }
         }
 
         /** @brief Add an edge between two nodes (for complex key type, SFINAE)
@@ -255,10 +324,10 @@ namespace xnetwork {
         template <typename U = key_type> auto add_edge(const Node& node_u, const Node& node_v) ->
             typename std::enable_if<!std::is_same<U, value_type>::value>::type {
             using T = typename adjlist_t::mapped_type;
-            auto data = this->_adj[node_u].get(node_v, T{});
-            this->_adj[node_u][node_v] = data;
-            this->_adj[node_v][node_u] = data;
-            ++this->_num_of_edges;
+            if (this->_adj[node_u].contains(node_v)) return;
+            this->_adj[node_u][node_v] = T{};
+            this->_adj[node_v][node_u] = T{};
+            this->_on_new_edge(node_u, node_v);
         }
 
         /** @brief Add an edge with attached data
@@ -267,12 +336,16 @@ namespace xnetwork {
             @param[in] node_v Second endpoint
             @param[in] data Data to associate with the edge */
         template <typename T> auto add_edge(const Node& node_u, const Node& node_v, const T& data) {
+            if (!this->_adj[node_u].contains(node_v)) {
+                this->_on_new_edge(node_u, node_v);
+            }
             this->_adj[node_u][node_v] = data;
             this->_adj[node_v][node_u] = data;
-            ++this->_num_of_edges;
         }
 
         /** @brief Add edges from a container of edge pairs
+            @details Inserts one edge at a time; use GraphBuilder to construct a
+            large graph from a whole edge list.
             @tparam C1 Container type for edges
             @param[in] edges Container of edge pairs */
         template <typename C1> auto add_edges_from(const C1& edges) {
@@ -294,6 +367,118 @@ namespace xnetwork {
             }
         }
 
+        /** @brief Remove the edge between two nodes
+            @param[in] node_u First endpoint
+            @param[in] node_v Second endpoint
+            @exception XNetworkError if there is no edge between node_u and node_v */
+        auto remove_edge(const Node& node_u, const Node& node_v) -> void {
+            if (!this->_remove_edge(node_u, node_v)) {
+                throw XNetworkError("remove_edge: the edge is not in the graph");
+            }
+        }
+
+        /** @brief Remove edges from a container of edge pairs
+            @details Edges that are not in the graph are silently ignored.
+            @tparam C1 Container type for edges
+            @param[in] edges Container of edge pairs */
+        template <typename C1> auto remove_edges_from(const C1& edges) -> void {
+            for (const auto& e : edges) {
+                this->_remove_edge(e.first, e.second);
+            }
+        }
+
+        /** @brief Remove a node and all its incident edges in O(degree)
+            @details The node is tombstoned rather than erased from the node
+            container; call compact() to reclaim dense integer ids.
+            @param[in] node The node to remove
+            @exception XNetworkError if the node is not in the graph */
+        auto remove_node(const Node& node) -> void {
+            if (!this->has_node(node)) {
+                throw XNetworkError("remove_node: the node is not in the graph");
+            }
+            auto& nbrs = this->_adj[node];
+            for (const auto& item : nbrs) {
+                const auto& nbr = detail::adj_key(item);
+                if (nbr != node) {
+                    this->_adj[nbr].erase(node);
+                }
+            }
+            this->_num_of_edges -= nbrs.size();
+            nbrs.clear();
+            this->_tombstones.insert(node);
+            ++this->_version;
+        }
+
+        /** @brief Remove nodes from a container, ignoring nodes not in the graph
+            @tparam C1 Container type for nodes
+            @param[in] nodes Container of nodes */
+        template <typename C1> auto remove_nodes_from(const C1& nodes) -> void {
+            for (const auto& node : nodes) {
+                if (this->has_node(node)) {
+                    this->remove_node(node);
+                }
+            }
+        }
+
+        /** @brief Append an isolated node with the next free integer id
+            @details Only for graphs with integer nodes 0 .. n-1 and vector
+            adjacency (e.g. SimpleGraph). Amortized O(1).
+            @return The id of the new node */
+        auto append_node() -> Node {
+            static_assert(detail::is_resizable<adjlist_outer_dict_factory>::value,
+                          "append_node() requires dense integer nodes with vector adjacency");
+            const auto node = static_cast<Node>(this->_node.size());
+            this->_adj.emplace_back();
+            this->_node = py::range<uint32_t>(static_cast<uint32_t>(node + 1));
+            ++this->_version;
+            return node;
+        }
+
+        /** @brief Number of removed nodes still occupying an id */
+        auto number_of_tombstones() const -> size_t { return this->_tombstones.size(); }
+
+        /** @brief Renumber the surviving nodes densely, dropping tombstones
+            @details Only for graphs with integer nodes 0 .. n-1 and vector
+            adjacency (e.g. SimpleGraph). The relative order of the surviving
+            nodes is preserved. Costs O(V + E).
+            @return Mapping from each new node id to its old id */
+        auto compact() -> std::vector<Node> {
+            static_assert(detail::is_resizable<adjlist_outer_dict_factory>::value,
+                          "compact() requires dense integer nodes with vector adjacency");
+            const auto num_nodes = this->_node.size();
+            std::vector<Node> new_to_old;
+            new_to_old.reserve(num_nodes - this->_tombstones.size());
+            std::vector<Node> old_to_new(num_nodes);
+            for (const auto& node : this->_node) {
+                if (!this->_tombstones.contains(node)) {
+                    old_to_new[node] = static_cast<Node>(new_to_old.size());
+                    new_to_old.push_back(node);
+                }
+            }
+            const auto relabel = [&old_to_new](const Node& node) { return old_to_new[node]; };
+            using item_t
+                = decltype(detail::relabel_item(std::declval<const value_type&>(), relabel));
+            std::vector<item_t> buffer;
+            for (size_t idx = 0; idx != new_to_old.size(); ++idx) {
+                auto& nbrs = this->_adj[idx];
+                if (idx != new_to_old[idx]) {
+                    // the slot at idx was a tombstone or has already been moved down
+                    std::swap(nbrs, this->_adj[new_to_old[idx]]);
+                }
+                buffer.clear();
+                for (const auto& item : nbrs) {
+                    buffer.push_back(detail::relabel_item(item, relabel));
+                }
+                nbrs.clear();
+                nbrs.insert(buffer.begin(), buffer.end());
+            }
+            this->_adj.resize(new_to_old.size());
+            this->_node = py::range<uint32_t>(static_cast<uint32_t>(new_to_old.size()));
+            this->_tombstones.clear();
+            ++this->_version;
+            return new_to_old;
+        }
+
         /** @brief Check if an edge exists between two nodes
             @param[in] node_u First endpoint
             @param[in] node_v Second endpoint
@@ -307,11 +492,32 @@ namespace xnetwork {
             @return The number of edges incident to the node */
         auto degree(const Node& node) const { return this->_adj[node].size(); }
 
-        /** @brief Remove all nodes and edges from the graph */
+        /** @brief Cached degree array with histogram and degree ordering
+            @details Only for integer nodes 0 .. n-1; re-gathered after mutation. */
+        auto degree_view() const -> DegreeView<Graph> { return DegreeView<Graph>{*this}; }
+
+        /** @brief Counter bumped by every structural change (edge or node added or
+            removed) made through the methods; lets caches detect mutation.
+            Writes through the non-const operator[] are not counted. */
+        auto version() const -> size_t { return this->_version; }
+
+        /** @brief Estimated heap footprint (see memory_usage.hpp); O(V) */
+        auto memory_usage() const -> MemoryUsage {
+            MemoryUsage usage;
+            usage.nodes = detail::heap_bytes(this->_node);
+            detail::account_adjacency(this->_adj, usage);
+            usage.other = detail::heap_bytes(this->_tombstones);
+            return usage;
+        }
+
+        /** @brief Remove all edges (and tombstones); nodes are kept
+            @details number_of_nodes() is unchanged. With vector adjacency each
+            node keeps its (now empty) row; otherwise the adjacency is emptied. */
         auto clear() {
-            this->_adj.clear();
-            // this->_node.clear();
-            // this->graph.clear();
+            detail::clear_adjacency(this->_adj);
+            this->_num_of_edges = 0;
+            this->_tombstones.clear();
+            ++this->_version;
         }
 
         /** @brief Apply a callable to each edge without materializing a vector
@@ -336,6 +542,28 @@ namespace xnetwork {
         /** @brief Check if the graph is directed
             @return false (this is an undirected graph) */
         auto is_directed() const { return false; }
+
+      private:
+        auto _remove_edge(const Node& node_u, const Node& node_v) -> bool {
+            if (this->_adj[node_u].erase(node_v) == 0) return false;
+            if (node_u != node_v) {
+                this->_adj[node_v].erase(node_u);
+            }
+            --this->_num_of_edges;
+            ++this->_version;
+            return true;
+        }
+
+      protected:
+        /** @brief Count a newly inserted edge and revive tombstoned endpoints */
+        auto _on_new_edge(const Node& node_u, const Node& node_v) -> void {
+            ++this->_num_of_edges;
+            ++this->_version;
+            if (!this->_tombstones.empty()) {
+                this->_tombstones.erase(node_u);
+                this->_tombstones.erase(node_v);
+            }
+        }
     };
 
     /** @brief A simple undirected graph with integer nodes
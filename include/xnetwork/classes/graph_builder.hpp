@@ -0,0 +1,414 @@
+/**
+ * @file graph_builder.hpp
+ * @brief Bulk construction of graphs from whole edge lists
+ *
+ * Defines the GraphBuilder class template. Instead of inserting edges one at a
+ * time into hash sets, the builder collects the whole edge list, radix-sorts and
+ * dedupes it, and then fills every adjacency exactly once with its final size
+ * known in advance. It can also emit a CsrGraph directly.
+ *
+ * ConcurrentGraphBuilder is the multi-threaded variant: producer threads append
+ * edges to their own shard without locking, and build() merges the shards in
+ * parallel, one node range per task.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <future>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/graph.hpp>
+#include <xnetwork/thread_pool.hpp>
+
+namespace xnetwork {
+
+    namespace detail {
+
+        /**
+         * @brief LSD radix sort of 64-bit keys whose values fit in `num_bits` bits.
+         *
+         * Uses 11-bit digits (2048 counters, L1 resident) and falls back to
+         * std::sort for small inputs.
+         *
+         * @param keys      keys to sort (sorted in place)
+         * @param num_bits  number of significant bits in every key
+         */
+        inline void radix_sort_keys(std::vector<uint64_t>& keys, unsigned num_bits) {
+            constexpr unsigned digit_bits = 11;
+            constexpr size_t num_buckets = size_t{1} << digit_bits;
+            if (keys.size() < 1024) {
+                std::sort(keys.begin(), keys.end());
+                return;
+            }
+            std::vector<uint64_t> buffer(keys.size());
+            std::vector<size_t> count(num_buckets);
+            for (unsigned shift = 0; shift < num_bits; shift += digit_bits) {
+                std::fill(count.begin(), count.end(), 0);
+                for (const auto key : keys) {
+                    ++count[(key >> shift) & (num_buckets - 1)];
+                }
+                size_t pos = 0;
+                for (auto& cnt : count) {
+                    const auto tmp = cnt;
+                    cnt = pos;
+                    pos += tmp;
+                }
+                for (const auto key : keys) {
+                    buffer[count[(key >> shift) & (num_buckets - 1)]++] = key;
+                }
+                keys.swap(buffer);
+            }
+        }
+
+        /** @brief Number of bits needed to represent the values 0 .. num_values-1 (min 1) */
+        inline auto bits_for(uint64_t num_values) -> unsigned {
+            unsigned bits = 1;
+            while (bits < 64 && (uint64_t{1} << bits) < num_values) {
+                ++bits;
+            }
+            return bits;
+        }
+
+    }  // namespace detail
+
+    /** @brief Bulk builder for graphs with dense integer nodes
+        @details Edges are appended to a flat buffer; build() sorts and dedupes
+        the buffer once, sizes every adjacency with its final degree and fills it
+        without rehashing. Parallel and reversed duplicates are collapsed, so the
+        resulting edge count is exact.
+        @tparam Graph The graph type produced by build() (SimpleGraph or CsrGraph) */
+    template <typename Graph = SimpleGraph> class GraphBuilder {
+      public:
+        using node_t = uint32_t;
+        using edge_t = std::pair<node_t, node_t>;
+
+        /** @brief Construct a builder for a graph with a given number of nodes
+            @param[in] num_nodes Number of nodes (0 to num_nodes-1) */
+        explicit GraphBuilder(uint32_t num_nodes)
+            : _num_nodes{num_nodes}, _shift{detail::bits_for(num_nodes)} {}
+
+        /** @brief Reserve buffer space for a number of edges */
+        auto reserve(size_t num_edges) -> void { this->_arcs.reserve(2 * num_edges); }
+
+        /** @brief Get the number of nodes of the graph being built */
+        auto number_of_nodes() const -> size_t { return this->_num_nodes; }
+
+        /** @brief Append an undirected edge (duplicates are allowed)
+            @param[in] node_u First endpoint
+            @param[in] node_v Second endpoint */
+        auto add_edge(node_t node_u, node_t node_v) -> void {
+            assert(node_u < this->_num_nodes && node_v < this->_num_nodes);
+            this->_arcs.push_back(this->_key(node_u, node_v));
+            if (node_u != node_v) {
+                this->_arcs.push_back(this->_key(node_v, node_u));
+            }
+        }
+
+        /** @brief Append edges from a container of edge pairs
+            @tparam C1 Container type for edges
+            @param[in] edges Container of edge pairs */
+        template <typename C1> auto add_edges_from(const C1& edges) -> void {
+            for (const auto& e : edges) {
+                this->add_edge(static_cast<node_t>(e.first), static_cast<node_t>(e.second));
+            }
+        }
+
+        /** @brief Build the graph, consuming the buffered edges
+            @return Graph containing the deduplicated edges */
+        auto build() -> Graph {
+            if constexpr (std::is_same_v<Graph, CsrGraph>) {
+                return this->build_csr();
+            } else {
+                Graph gra(this->_num_nodes);
+                this->build_into(gra);
+                return gra;
+            }
+        }
+
+        /** @brief Insert the buffered edges into an existing graph, consuming them
+            @details Each adjacency is reserved once for its final size before it
+            is filled. Edges already present in `gra` are not counted twice.
+            Tombstoned endpoints are revived, as with Graph::add_edge().
+            @param[in,out] gra Graph with (at least) number_of_nodes() nodes */
+        auto build_into(Graph& gra) -> void {
+            const auto arcs = this->_sorted_arcs();
+            const auto mask = (uint64_t{1} << this->_shift) - 1;
+            bool inserted = false;
+            auto first = arcs.begin();
+            while (first != arcs.end()) {
+                const auto node_u = static_cast<node_t>(*first >> this->_shift);
+                auto last = first;
+                while (last != arcs.end() && static_cast<node_t>(*last >> this->_shift) == node_u) {
+                    ++last;
+                }
+                auto& nbrs = gra._adj[node_u];
+                nbrs.reserve(nbrs.size() + static_cast<size_t>(last - first));
+                for (; first != last; ++first) {
+                    const auto node_v = static_cast<node_t>(*first & mask);
+                    if (nbrs.insert(node_v).second) {
+                        inserted = true;
+                        if (node_u <= node_v) ++gra._num_of_edges;
+                    }
+                }
+                // arcs come in both directions, so this covers every endpoint
+                if (!gra._tombstones.empty()) gra._tombstones.erase(node_u);
+            }
+            if (inserted) ++gra._version;
+        }
+
+        /** @brief Build a CsrGraph directly from the buffered edges, consuming them
+            @return Immutable CSR snapshot with sorted neighbor rows */
+        auto build_csr() -> CsrGraph {
+            const auto arcs = this->_sorted_arcs();
+            const auto mask = (uint64_t{1} << this->_shift) - 1;
+            std::vector<CsrGraph::offset_t> offsets(size_t{this->_num_nodes} + 1, 0);
+            std::vector<node_t> neighbors;
+            neighbors.reserve(arcs.size());
+            for (const auto key : arcs) {
+                ++offsets[static_cast<size_t>(key >> this->_shift) + 1];
+                neighbors.push_back(static_cast<node_t>(key & mask));
+            }
+            for (size_t idx = 0; idx != this->_num_nodes; ++idx) {
+                offsets[idx + 1] += offsets[idx];
+            }
+            return CsrGraph{std::move(offsets), std::move(neighbors)};
+        }
+
+      private:
+        auto _key(node_t node_u, node_t node_v) const -> uint64_t {
+            return (uint64_t{node_u} << this->_shift) | node_v;
+        }
+
+        auto _sorted_arcs() -> std::vector<uint64_t> {
+            auto arcs = std::move(this->_arcs);
+            this->_arcs = {};
+            detail::radix_sort_keys(arcs, 2 * this->_shift);
+            arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+            return arcs;
+        }
+
+        uint32_t _num_nodes;
+        unsigned _shift;
+        std::vector<uint64_t> _arcs{};
+    };
+
+    /** @brief Multi-threaded bulk builder for graphs with dense integer nodes
+        @details Each producer thread appends edges to its own Shard (no locks,
+        no shared writes). build() then runs in three parallel phases on a
+        thread pool:
+        1. every shard scatters its arcs into buckets by source-node range;
+        2. every node range gathers its buckets from all shards, radix-sorts and
+           dedupes them, and fills the adjacency of its own nodes (for
+           SimpleGraph-like graphs) or its slice of the CSR rows;
+        3. for CsrGraph, the slices are concatenated at their prefix offsets.
+        The result is identical to GraphBuilder's.
+        @tparam Graph The graph type produced by build() (SimpleGraph-like with
+                      vector adjacency, or CsrGraph) */
+    template <typename Graph = SimpleGraph> class ConcurrentGraphBuilder {
+      public:
+        using node_t = uint32_t;
+        using edge_t = std::pair<node_t, node_t>;
+
+        /** @brief Edge buffer owned by one producer thread */
+        class alignas(64) Shard {
+          public:
+            /** @brief Reserve buffer space for a number of edges */
+            auto reserve(size_t num_edges) -> void { this->_arcs.reserve(2 * num_edges); }
+
+            /** @brief Append an undirected edge (duplicates are allowed) */
+            auto add_edge(node_t node_u, node_t node_v) -> void {
+                assert(node_u < this->_num_nodes && node_v < this->_num_nodes);
+                this->_arcs.push_back((uint64_t{node_u} << this->_shift) | node_v);
+                if (node_u != node_v) {
+                    this->_arcs.push_back((uint64_t{node_v} << this->_shift) | node_u);
+                }
+            }
+
+            /** @brief Append edges from a container of edge pairs */
+            template <typename C1> auto add_edges_from(const C1& edges) -> void {
+                for (const auto& e : edges) {
+                    this->add_edge(static_cast<node_t>(e.first), static_cast<node_t>(e.second));
+                }
+            }
+
+          private:
+            friend class ConcurrentGraphBuilder;
+
+            uint32_t _num_nodes = 0;
+            unsigned _shift = 1;
+            std::vector<uint64_t> _arcs{};
+        };
+
+        /** @brief Construct a builder with one shard per producer thread
+            @param[in] num_nodes Number of nodes (0 to num_nodes-1)
+            @param[in] num_shards Number of independent edge buffers */
+        ConcurrentGraphBuilder(uint32_t num_nodes, size_t num_shards)
+            : _num_nodes{num_nodes},
+              _shift{detail::bits_for(num_nodes)},
+              _shards(std::max<size_t>(num_shards, 1)) {
+            for (auto& shard : this->_shards) {
+                shard._num_nodes = num_nodes;
+                shard._shift = this->_shift;
+            }
+        }
+
+        /** @brief Get the number of nodes of the graph being built */
+        auto number_of_nodes() const -> size_t { return this->_num_nodes; }
+
+        /** @brief Get the number of shards */
+        auto number_of_shards() const -> size_t { return this->_shards.size(); }
+
+        /** @brief Access a shard; each thread must append to a different shard
+            @param[in] idx Shard index, 0 .. number_of_shards()-1 */
+        auto shard(size_t idx) -> Shard& { return this->_shards[idx]; }
+
+        /** @brief Merge all shards into a graph on a thread pool, consuming them
+            @param[in] pool Thread pool running the merge tasks
+            @return Graph containing the deduplicated edges */
+        auto build(thread_pool& pool) -> Graph {
+            const uint64_t num_nodes = this->_num_nodes;
+            const auto num_ranges = std::max<uint64_t>(
+                1, std::min<uint64_t>(num_nodes, 4 * std::max<size_t>(pool.size(), 1)));
+            const auto width = std::max<uint64_t>(1, (num_nodes + num_ranges - 1) / num_ranges);
+            const auto used_ranges = static_cast<size_t>((num_nodes + width - 1) / width);
+            const auto shift = this->_shift;
+
+            // Phase 1: scatter each shard into per-range buckets
+            std::vector<std::vector<std::vector<uint64_t>>> buckets(this->_shards.size());
+            {
+                std::vector<std::future<void>> tasks;
+                for (size_t sid = 0; sid != this->_shards.size(); ++sid) {
+                    tasks.push_back(pool.enqueue([&, sid]() {
+                        auto arcs = std::move(this->_shards[sid]._arcs);
+                        this->_shards[sid]._arcs = {};
+                        std::vector<size_t> count(used_ranges, 0);
+                        for (const auto key : arcs) {
+                            ++count[static_cast<size_t>((key >> shift) / width)];
+                        }
+                        auto& mine = buckets[sid];
+                        mine.resize(used_ranges);
+                        for (size_t rid = 0; rid != used_ranges; ++rid) {
+                            mine[rid].reserve(count[rid]);
+                        }
+                        for (const auto key : arcs) {
+                            mine[static_cast<size_t>((key >> shift) / width)].push_back(key);
+                        }
+                    }));
+                }
+                wait_all(tasks);  // the tasks borrow `buckets`
+                for (auto& task : tasks) {
+                    task.get();
+                }
+            }
+
+            // Phase 2: per node range, gather, sort and dedupe
+            auto gather = [&, shift](size_t rid) {
+                size_t total = 0;
+                for (const auto& mine : buckets) {
+                    total += mine[rid].size();
+                }
+                std::vector<uint64_t> keys;
+                keys.reserve(total);
+                const auto base = (rid * width) << shift;
+                for (auto& mine : buckets) {
+                    for (const auto key : mine[rid]) {
+                        keys.push_back(key - base);  // fewer significant bits to sort
+                    }
+                    mine[rid] = {};
+                }
+                detail::radix_sort_keys(keys, shift + detail::bits_for(width));
+                keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+                return keys;
+            };
+            const auto mask = (uint64_t{1} << shift) - 1;
+
+            if constexpr (std::is_same_v<Graph, CsrGraph>) {
+                std::vector<CsrGraph::offset_t> offsets(num_nodes + 1, 0);
+                std::vector<std::future<std::vector<node_t>>> slices;
+                for (size_t rid = 0; rid != used_ranges; ++rid) {
+                    slices.push_back(pool.enqueue([&, rid]() {
+                        const auto keys = gather(rid);
+                        std::vector<node_t> nbrs;
+                        nbrs.reserve(keys.size());
+                        for (const auto key : keys) {
+                            ++offsets[rid * width + (key >> shift) + 1];  // own range only
+                            nbrs.push_back(static_cast<node_t>(key & mask));
+                        }
+                        return nbrs;
+                    }));
+                }
+                wait_all(slices);  // the tasks borrow `buckets` and `offsets`
+                std::vector<std::vector<node_t>> parts;
+                for (auto& slice : slices) {
+                    parts.push_back(slice.get());
+                }
+
+                // Phase 3: concatenate the slices at their prefix positions
+                for (size_t idx = 0; idx != num_nodes; ++idx) {
+                    offsets[idx + 1] += offsets[idx];
+                }
+                std::vector<node_t> neighbors(offsets[num_nodes]);
+                std::vector<std::future<void>> copies;
+                for (size_t rid = 0; rid != used_ranges; ++rid) {
+                    copies.push_back(pool.enqueue([&, rid]() {
+                        std::copy(parts[rid].begin(), parts[rid].end(),
+                                  neighbors.begin()
+                                      + static_cast<ptrdiff_t>(offsets[rid * width]));
+                        parts[rid] = {};
+                    }));
+                }
+                wait_all(copies);  // the tasks borrow `parts`, `offsets` and `neighbors`
+                for (auto& copy : copies) {
+                    copy.get();
+                }
+                return CsrGraph{std::move(offsets), std::move(neighbors)};
+            } else {
+                using outer_t = std::decay_t<decltype(std::declval<Graph&>()._adj)>;
+                static_assert(detail::is_resizable<outer_t>::value,
+                              "ConcurrentGraphBuilder needs a per-node vector adjacency");
+                Graph gra(this->_num_nodes);
+                std::vector<std::future<size_t>> tasks;
+                for (size_t rid = 0; rid != used_ranges; ++rid) {
+                    tasks.push_back(pool.enqueue([&, rid]() {
+                        const auto keys = gather(rid);
+                        size_t num_edges = 0;
+                        auto first = keys.begin();
+                        while (first != keys.end()) {
+                            const auto local = *first >> shift;
+                            auto last = first;
+                            while (last != keys.end() && (*last >> shift) == local) {
+                                ++last;
+                            }
+                            // each range owns the adjacency of its own nodes
+                            const auto node_u = static_cast<node_t>(rid * width + local);
+                            auto& nbrs = gra._adj[node_u];
+                            nbrs.reserve(static_cast<size_t>(last - first));
+                            for (; first != last; ++first) {
+                                const auto node_v = static_cast<node_t>(*first & mask);
+                                nbrs.insert(node_v);
+                                if (node_u <= node_v) ++num_edges;
+                            }
+                        }
+                        return num_edges;
+                    }));
+                }
+                wait_all(tasks);  // the tasks borrow `buckets` and `gra`
+                for (auto& task : tasks) {
+                    gra._num_of_edges += task.get();
+                }
+                return gra;
+            }
+        }
+
+      private:
+        uint32_t _num_nodes;
+        unsigned _shift;
+        std::vector<Shard> _shards;
+    };
+
+}  // namespace xnetwork
@@ -0,0 +1,200 @@
+/**
+ * @file labeled_graph.hpp
+ * @brief Interning of arbitrary node keys to dense ids, and a labeled graph on top
+ *
+ * The algorithms are instantiated for graphs with dense uint32_t nodes. A
+ * graph keyed by strings (e.g. the cell and net names of a netlist) would
+ * hash a string on every hop. NodeInterner assigns each distinct key a dense
+ * id 0 .. n-1 once, and LabeledGraph keeps a SimpleGraph over those ids,
+ * translating keys only at the API boundary. graph() hands the dense graph to
+ * any uint32_t algorithm (or to freeze()); map_forward() and map_back()
+ * translate weights and results, like their reorder.hpp counterparts.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/graph.hpp>
+#include <xnetwork/exception.hpp>
+
+namespace xnetwork {
+
+    /** @brief Bijection between arbitrary hashable keys and dense ids 0 .. n-1
+        @tparam K The key type (e.g. std::string) */
+    template <typename K> class NodeInterner {
+      public:
+        using key_type = K;
+        using id_t = uint32_t;
+
+        /** @brief Reserve room for `count` keys */
+        auto reserve(size_t count) -> void {
+            this->_ids.reserve(count);
+            this->_keys.reserve(count);
+        }
+
+        /** @brief Id of a key, assigning the next free id if the key is new */
+        auto intern(const K& key) -> id_t {
+            const auto [iter, inserted] = this->_ids.try_emplace(key, this->size());
+            if (inserted) this->_keys.push_back(key);
+            return iter->second;
+        }
+
+        /** @brief Id of a known key
+            @exception XNetworkError if the key was never interned */
+        auto id(const K& key) const -> id_t {
+            const auto iter = this->_ids.find(key);
+            if (iter == this->_ids.end()) {
+                throw XNetworkError("NodeInterner: unknown key");
+            }
+            return iter->second;
+        }
+
+        /** @brief Check if a key has been interned */
+        auto contains(const K& key) const -> bool { return this->_ids.contains(key); }
+
+        /** @brief Key of an id (O(1), no hashing) */
+        auto key(id_t node) const -> const K& { return this->_keys[node]; }
+
+        /** @brief Number of interned keys; ids are 0 .. size()-1 */
+        auto size() const -> id_t { return static_cast<id_t>(this->_keys.size()); }
+
+        /** @brief All keys, indexed by id */
+        auto keys() const -> const std::vector<K>& { return this->_keys; }
+
+      private:
+        py::dict<K, id_t> _ids{};
+        std::vector<K> _keys{};
+    };
+
+    /** @brief Undirected graph with arbitrary node keys stored as a dense SimpleGraph
+        @details Keys are hashed once per API call; neighbor walks, degrees and
+        all algorithms run on the dense ids of graph().
+        @tparam K The node key type (e.g. std::string) */
+    template <typename K> class LabeledGraph {
+      public:
+        using key_type = K;
+        using graph_t = SimpleGraph;
+        using node_t = graph_t::node_t;
+
+        /** @brief Construct an empty graph */
+        LabeledGraph() : _graph{0U} {}
+
+        /** @brief Add a node (no-op if it exists)
+            @return Its dense id */
+        auto add_node(const K& key) -> node_t {
+            const auto node = this->_interner.intern(key);
+            if (node == this->_graph.size()) this->_graph.append_node();
+            return node;
+        }
+
+        /** @brief Add an edge, adding missing endpoints */
+        auto add_edge(const K& key_u, const K& key_v) -> void {
+            const auto node_u = this->add_node(key_u);
+            const auto node_v = this->add_node(key_v);
+            this->_graph.add_edge(node_u, node_v);
+        }
+
+        /** @brief Add the edges (pairs of keys) of a container */
+        template <typename C1> auto add_edges_from(const C1& edges) -> void {
+            for (const auto& [key_u, key_v] : edges) {
+                this->add_edge(key_u, key_v);
+            }
+        }
+
+        /** @brief Remove an edge
+            @exception XNetworkError if an endpoint or the edge does not exist */
+        auto remove_edge(const K& key_u, const K& key_v) -> void {
+            this->_graph.remove_edge(this->id(key_u), this->id(key_v));
+        }
+
+        /** @brief Check if a node exists */
+        auto has_node(const K& key) const -> bool { return this->_interner.contains(key); }
+
+        /** @brief Check if a node exists */
+        auto contains(const K& key) const -> bool { return this->_interner.contains(key); }
+
+        /** @brief Check if an edge exists (false if an endpoint is unknown) */
+        auto has_edge(const K& key_u, const K& key_v) const -> bool {
+            if (!this->has_node(key_u) || !this->has_node(key_v)) return false;
+            return this->_graph.has_edge(this->id(key_u), this->id(key_v));
+        }
+
+        /** @brief Degree of a node
+            @exception XNetworkError if the node does not exist */
+        auto degree(const K& key) const -> size_t { return this->_graph.degree(this->id(key)); }
+
+        /** @brief Keys of the neighbors of a node
+            @exception XNetworkError if the node does not exist */
+        auto neighbors(const K& key) const -> std::vector<K> {
+            std::vector<K> result;
+            for (const auto nbr : this->_graph[this->id(key)]) {
+                result.push_back(this->_interner.key(nbr));
+            }
+            return result;
+        }
+
+        /** @brief Number of nodes */
+        auto number_of_nodes() const -> size_t { return this->_graph.number_of_nodes(); }
+
+        /** @brief Number of edges */
+        auto number_of_edges() const -> size_t { return this->_graph.number_of_edges(); }
+
+        /** @brief Dense id of a node
+            @exception XNetworkError if the node does not exist */
+        auto id(const K& key) const -> node_t { return this->_interner.id(key); }
+
+        /** @brief Key of a dense id */
+        auto key(node_t node) const -> const K& { return this->_interner.key(node); }
+
+        /** @brief The key <-> id mapping */
+        auto interner() const -> const NodeInterner<K>& { return this->_interner; }
+
+        /** @brief The dense-id graph, for the uint32_t algorithms */
+        auto graph() const -> const graph_t& { return this->_graph; }
+
+      private:
+        NodeInterner<K> _interner{};
+        graph_t _graph;
+    };
+
+    /** @brief Map a set of dense ids (e.g. a vertex cover) to keys */
+    template <typename K>
+    auto map_back(const NodeInterner<K>& interner, const py::set<uint32_t>& nodes) -> py::set<K> {
+        py::set<K> result;
+        result.reserve(nodes.size());
+        for (const auto node : nodes) {
+            result.insert(interner.key(node));
+        }
+        return result;
+    }
+
+    /** @brief Map a sequence of dense ids (e.g. a tour or a cycle) to keys, keeping its order */
+    template <typename K>
+    auto map_back(const NodeInterner<K>& interner, const std::vector<uint32_t>& nodes)
+        -> std::vector<K> {
+        std::vector<K> result;
+        result.reserve(nodes.size());
+        for (const auto node : nodes) {
+            result.push_back(interner.key(node));
+        }
+        return result;
+    }
+
+    /** @brief Map a keyed node weight map to dense ids
+        @exception XNetworkError if a key was never interned */
+    template <typename K, typename T>
+    auto map_forward(const NodeInterner<K>& interner, const py::dict<K, T>& weight)
+        -> py::dict<uint32_t, T> {
+        py::dict<uint32_t, T> result;
+        result.reserve(weight.size());
+        for (const auto& [key, value] : weight) {
+            result[interner.id(key)] = value;
+        }
+        return result;
+    }
+
+}  // namespace xnetwork
@@ -0,0 +1,157 @@
+/**
+ * @file memory_usage.hpp
+ * @brief Memory footprint accounting for graphs and algorithm workspaces
+ *
+ * The graph classes report their heap footprint through memory_usage(),
+ * broken down into the node container, the outer adjacency (one slot per
+ * node), the neighbor sets or arrays, and bookkeeping such as tombstones or
+ * a predecessor index. Byte counts are estimates from container capacities:
+ * a hashed set is charged its bucket array plus one allocation per element
+ * (a next pointer and the value, rounded up to the 16-byte malloc granule),
+ * a vector its capacity. They are meant for choosing representations and
+ * batch sizes, not for exact accounting.
+ *
+ * WorkspaceProbe reports the peak size of the temporaries of long-running
+ * algorithms (pd_cover and the covers built on it, generic_bfs_cycle). The
+ * algorithms record their workspace only while a probe is alive on the
+ * calling thread, so the cost without a probe is one thread-local load.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace xnetwork {
+
+    /** @brief Estimated heap footprint of a graph, in bytes */
+    struct MemoryUsage {
+        size_t nodes = 0;            ///< Node container
+        size_t outer_adjacency = 0;  ///< Outer adjacency container (one slot per node)
+        size_t inner_adjacency = 0;  ///< Neighbor sets or arrays
+        size_t other = 0;            ///< Tombstones, predecessor index, upper offsets, ...
+        double load_factor = 0.0;    ///< Elements per bucket over all hashed neighbor sets
+
+        /** @brief Sum of all parts */
+        auto total() const -> size_t {
+            return this->nodes + this->outer_adjacency + this->inner_adjacency + this->other;
+        }
+    };
+
+    namespace detail {
+        /** @brief Detects hashed containers (unordered_set, py::set, py::dict, ...) */
+        template <typename T, typename = void> struct is_hashed : std::false_type {};
+
+        template <typename T>
+        struct is_hashed<T, std::void_t<decltype(std::declval<const T&>().bucket_count())>>
+            : std::true_type {};
+
+        /** @brief Detects containers with contiguous reserved storage (vector, flat_set, ...) */
+        template <typename T, typename = void> struct has_capacity : std::false_type {};
+
+        template <typename T>
+        struct has_capacity<T, std::void_t<decltype(std::declval<const T&>().capacity())>>
+            : std::true_type {};
+
+        /** @brief Detects bit sets exposing their word vector (NodeBitset) */
+        template <typename T, typename = void> struct has_words : std::false_type {};
+
+        template <typename T>
+        struct has_words<T, std::void_t<decltype(std::declval<const T&>().words().capacity())>>
+            : std::true_type {};
+
+        /** @brief Bytes actually taken by an allocation of `bytes` (16-byte granule) */
+        constexpr auto alloc_bytes(size_t bytes) -> size_t { return (bytes + 15) / 16 * 16; }
+
+        /** @brief Estimated heap bytes owned directly by a container (not by its elements)
+            @details Containers that are neither hashed nor contiguous (e.g.
+            py::range) are charged nothing. */
+        template <typename C> auto heap_bytes(const C& cont) -> size_t {
+            using value_t = typename C::value_type;
+            if constexpr (is_hashed<C>::value) {
+                return cont.bucket_count() * sizeof(void*)
+                       + cont.size() * alloc_bytes(sizeof(void*) + sizeof(value_t));
+            } else if constexpr (has_capacity<C>::value) {
+                return cont.capacity() * sizeof(value_t);
+            } else if constexpr (has_words<C>::value) {
+                return cont.words().capacity() * sizeof(uint64_t);
+            } else {
+                return 0;
+            }
+        }
+
+        /** @brief The row of an outer adjacency item (vector slot or dict pair) */
+        template <typename K, typename V> auto adj_row(const std::pair<const K, V>& item)
+            -> const V& {
+            return item.second;
+        }
+
+        template <typename V> auto adj_row(const V& item) -> const V& { return item; }
+
+        /** @brief Add the footprint of an outer adjacency and its rows to `usage` */
+        template <typename Adj> auto account_adjacency(const Adj& adj, MemoryUsage& usage)
+            -> void {
+            usage.outer_adjacency += heap_bytes(adj);
+            size_t elements = 0;
+            size_t buckets = 0;
+            for (const auto& item : adj) {
+                const auto& row = adj_row(item);
+                usage.inner_adjacency += heap_bytes(row);
+                using row_t = std::decay_t<decltype(row)>;
+                if constexpr (is_hashed<row_t>::value) {
+                    elements += row.size();
+                    buckets += row.bucket_count();
+                }
+            }
+            if (buckets != 0) {
+                usage.load_factor = static_cast<double>(elements) / static_cast<double>(buckets);
+            }
+        }
+    }  // namespace detail
+
+    /** @brief Records the peak workspace of the algorithms run on this thread
+        while it is alive
+        @details Probes nest; an algorithm reports to the innermost one. Not
+        copyable or movable, since the thread refers to it by address.
+
+        @code
+        xnetwork::WorkspaceProbe probe;
+        min_odd_cycle_cover(ugraph, weight, soln);
+        auto peak = probe.peak_bytes();
+        @endcode */
+    class WorkspaceProbe {
+      public:
+        WorkspaceProbe() : _outer{current()} { current() = this; }
+
+        ~WorkspaceProbe() { current() = this->_outer; }
+
+        WorkspaceProbe(const WorkspaceProbe&) = delete;
+        auto operator=(const WorkspaceProbe&) -> WorkspaceProbe& = delete;
+
+        /** @brief Largest workspace recorded so far, in bytes */
+        auto peak_bytes() const -> size_t { return this->_peak; }
+
+        /** @brief Record the workspace currently held by an algorithm
+            @details `bytes` is called only when a probe is alive, so the
+            estimate may walk the algorithm's temporaries.
+            @tparam F Callable `size_t()` */
+        template <typename F> static auto record(F&& bytes) -> void {
+            auto* probe = current();
+            if (probe == nullptr) return;
+            probe->_peak = std::max(probe->_peak, static_cast<size_t>(bytes()));
+        }
+
+      private:
+        static auto current() -> WorkspaceProbe*& {
+            thread_local WorkspaceProbe* probe = nullptr;
+            return probe;
+        }
+
+        WorkspaceProbe* _outer;
+        size_t _peak = 0;
+    };
+
+}  // namespace xnetwork
@@ -0,0 +1,183 @@
+/**
+ * @file node_bitset.hpp
+ * @brief Fixed-universe bitset of dense integer ids with a set-like interface
+ *
+ * Defines NodeBitset, a set of ids 0 .. n-1 stored as one bit each. Membership
+ * tests, insertions and erasures are single bit operations, and iteration
+ * skips empty words with count-trailing-zeros. It is used as the node and
+ * edge mask of SubGraphView and wherever a py::set of dense node ids would
+ * otherwise be hashed.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include <xnetwork/classes/bit_ops.hpp>
+
+namespace xnetwork {
+
+    /** @brief Set of ids 0 .. universe()-1 backed by a bit vector */
+    class NodeBitset {
+      public:
+        using key_type = uint32_t;
+        using value_type = uint32_t;
+        using size_type = size_t;
+
+        /** @brief Forward iterator over the members in ascending order */
+        class const_iterator {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = uint32_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const uint32_t*;
+            using reference = const uint32_t&;
+
+            const_iterator(const uint64_t* words, size_t word_idx, size_t num_words)
+                : _words{words}, _word_idx{word_idx}, _num_words{num_words} {
+                if (this->_word_idx < this->_num_words) {
+                    this->_word = this->_words[this->_word_idx];
+                    this->_seek();
+                }
+            }
+
+            auto operator*() const -> const uint32_t& { return this->_value; }
+
+            auto operator++() -> const_iterator& {
+                this->_word &= this->_word - 1;  // clear the lowest set bit
+                this->_seek();
+                return *this;
+            }
+
+            auto operator++(int) -> const_iterator {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            auto operator==(const const_iterator& other) const -> bool {
+                return this->_word_idx == other._word_idx && this->_word == other._word;
+            }
+
+            auto operator!=(const const_iterator& other) const -> bool {
+                return !(*this == other);
+            }
+
+          private:
+            auto _seek() -> void {
+                while (this->_word == 0) {
+                    if (++this->_word_idx == this->_num_words) return;
+                    this->_word = this->_words[this->_word_idx];
+                }
+                this->_value
+                    = static_cast<uint32_t>(this->_word_idx * 64 + detail::ctz64(this->_word));
+            }
+
+            const uint64_t* _words;
+            size_t _word_idx;
+            size_t _num_words;
+            uint64_t _word = 0;
+            uint32_t _value = 0;
+        };
+
+        using iterator = const_iterator;
+
+        /** @brief Construct an empty set over an empty universe */
+        NodeBitset() = default;
+
+        /** @brief Construct an empty set over the universe 0 .. universe-1 */
+        explicit NodeBitset(size_t universe)
+            : _universe{universe}, _words(detail::words_for(universe), 0) {}
+
+        /** @brief Construct the set of all ids 0 .. universe-1 */
+        static auto full(size_t universe) -> NodeBitset {
+            NodeBitset result(universe);
+            for (auto& word : result._words) {
+                word = ~uint64_t{0};
+            }
+            if (universe % 64 != 0) {
+                result._words.back() = (uint64_t{1} << (universe % 64)) - 1;
+            }
+            result._size = universe;
+            return result;
+        }
+
+        /** @brief Size of the universe (one past the largest storable id) */
+        auto universe() const -> size_t { return this->_universe; }
+
+        /** @brief Number of members (O(1)) */
+        auto size() const -> size_t { return this->_size; }
+
+        /** @brief Check if the set has no members */
+        auto empty() const -> bool { return this->_size == 0; }
+
+        /** @brief Check membership (a single bit test); ids outside the universe are absent */
+        auto contains(uint32_t key) const -> bool {
+            return key < this->_universe && ((this->_words[key / 64] >> (key % 64)) & 1U) != 0;
+        }
+
+        /** @brief Number of occurrences of a key (0 or 1) */
+        auto count(uint32_t key) const -> size_t { return this->contains(key) ? 1 : 0; }
+
+        /** @brief Add a key
+            @return true if the key was not a member before */
+        auto insert(uint32_t key) -> bool {
+            assert(key < this->_universe);
+            auto& word = this->_words[key / 64];
+            const auto bit = uint64_t{1} << (key % 64);
+            if ((word & bit) != 0) return false;
+            word |= bit;
+            ++this->_size;
+            return true;
+        }
+
+        /** @brief Remove a key
+            @return Number of keys removed (0 or 1) */
+        auto erase(uint32_t key) -> size_t {
+            if (!this->contains(key)) return 0;
+            this->_words[key / 64] &= ~(uint64_t{1} << (key % 64));
+            --this->_size;
+            return 1;
+        }
+
+        /** @brief Remove all members, keeping the universe */
+        auto clear() -> void {
+            std::fill(this->_words.begin(), this->_words.end(), 0);
+            this->_size = 0;
+        }
+
+        /** @brief Explicit copy, mirroring py::set::copy() */
+        auto copy() const -> NodeBitset { return *this; }
+
+        /** @brief Iterator to the smallest member */
+        auto begin() const -> const_iterator {
+            return {this->_words.data(), 0, this->_words.size()};
+        }
+
+        /** @brief Iterator past the largest member */
+        auto end() const -> const_iterator {
+            return {this->_words.data(), this->_words.size(), this->_words.size()};
+        }
+
+        /** @brief The underlying words, 64 ids per word, lowest id in bit 0 */
+        auto words() const -> const std::vector<uint64_t>& { return this->_words; }
+
+        friend auto operator==(const NodeBitset& lhs, const NodeBitset& rhs) -> bool {
+            return lhs._universe == rhs._universe && lhs._words == rhs._words;
+        }
+
+        friend auto operator!=(const NodeBitset& lhs, const NodeBitset& rhs) -> bool {
+            return !(lhs == rhs);
+        }
+
+      private:
+        size_t _universe = 0;
+        std::vector<uint64_t> _words{};
+        size_t _size = 0;
+    };
+
+}  // namespace xnetwork
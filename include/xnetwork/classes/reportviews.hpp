@@ -96,7 +96,14 @@ EdgeDataView
 */
 // from collections import Mapping, Set, Iterable
 // #include <initializer_list>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace xnetwork {
 
@@ -218,6 +225,261 @@ namespace xnetwork {
         // }
     };
 
+    namespace detail {
+        /** @brief Detects graphs that expose the neighbors greater than a node
+            through `upper(node)` (e.g. CsrGraph) */
+        template <typename graph_t, typename = void> struct has_upper_adjacency
+            : std::false_type {};
+
+        template <typename graph_t> struct has_upper_adjacency<
+            graph_t, std::void_t<decltype(std::declval<const graph_t&>().upper(
+                         std::declval<typename graph_t::node_t>()))>> : std::true_type {};
+    }  // namespace detail
+
+    /** @brief EdgeView class - acts as gra.edges() for an undirected graph
+        @details A lazy range over the edges (u, v) with u < v, produced by
+        walking the half-adjacency of each node: `gra.upper(u)` when the graph
+        provides it, otherwise the full row filtered by u < v. Nothing is allocated, and
+        the view reflects the graph at the time it is iterated. Self loops are
+        not reported. The adjacency iterators of `graph_t` must stay valid
+        after the (possibly temporary) neighbor view they came from is gone,
+        which holds for all graph classes of this library.
+        @tparam graph_t The graph type */
+    template <typename graph_t> class EdgeView {
+      public:
+        using node_t = typename graph_t::node_t;
+        using edge_t = std::pair<node_t, node_t>;
+        using value_type = edge_t;
+
+      private:
+        static constexpr bool use_upper = detail::has_upper_adjacency<graph_t>::value;
+        using node_iter_t = decltype(std::declval<const graph_t&>().begin());
+        using nbr_iter_t
+            = decltype(std::begin(std::declval<const graph_t&>()[std::declval<node_t>()]));
+
+      public:
+        /** @brief Forward iterator over the edges */
+        class const_iterator {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = edge_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const edge_t*;
+            using reference = const edge_t&;
+
+            const_iterator(const graph_t* gra, node_iter_t node, node_iter_t last)
+                : _gra{gra}, _node{node}, _last{last} {
+                if (this->_node != this->_last) {
+                    this->_open_row();
+                    this->_seek();
+                }
+            }
+
+            auto operator*() const -> const edge_t& { return this->_edge; }
+
+            auto operator->() const -> const edge_t* { return &this->_edge; }
+
+            auto operator++() -> const_iterator& {
+                ++*this->_nbr;
+                this->_seek();
+                return *this;
+            }
+
+            auto operator++(int) -> const_iterator {
+                auto tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            auto operator==(const const_iterator& other) const -> bool {
+                return this->_node == other._node
+                       && (this->_node == this->_last || *this->_nbr == *other._nbr);
+            }
+
+            auto operator!=(const const_iterator& other) const -> bool {
+                return !(*this == other);
+            }
+
+          private:
+            auto _open_row() -> void {
+                if constexpr (use_upper) {
+                    const auto row = this->_gra->upper(*this->_node);
+                    this->_nbr.emplace(std::begin(row));
+                    this->_nbr_end.emplace(std::end(row));
+                } else {
+                    auto&& row = (*this->_gra)[*this->_node];
+                    this->_nbr.emplace(std::begin(row));
+                    this->_nbr_end.emplace(std::end(row));
+                }
+            }
+
+            /** Advance to the first (u, v) with u < v at or after the current position */
+            auto _seek() -> void {
+                while (true) {
+                    const auto utx = *this->_node;
+                    for (; *this->_nbr != *this->_nbr_end; ++*this->_nbr) {
+                        if (use_upper || utx < **this->_nbr) {
+                            this->_edge = edge_t{utx, **this->_nbr};
+                            return;
+                        }
+                    }
+                    if (++this->_node == this->_last) return;
+                    this->_open_row();
+                }
+            }
+
+            const graph_t* _gra;
+            node_iter_t _node;
+            node_iter_t _last;
+            std::optional<nbr_iter_t> _nbr{};
+            std::optional<nbr_iter_t> _nbr_end{};
+            edge_t _edge{};
+        };
+
+        using iterator = const_iterator;
+
+        /** @brief Construct a view of the edges of a graph */
+        explicit EdgeView(const graph_t& gra) : _gra{&gra} {}
+
+        /** @brief Iterator to the first edge */
+        auto begin() const -> const_iterator {
+            return {this->_gra, this->_gra->begin(), this->_gra->end()};
+        }
+
+        /** @brief Iterator past the last edge */
+        auto end() const -> const_iterator {
+            return {this->_gra, this->_gra->end(), this->_gra->end()};
+        }
+
+        /** @brief Number of edges reported (O(n): number_of_edges() minus self loops) */
+        auto size() const -> size_t {
+            size_t loops = 0;
+            for (const auto& node : *this->_gra) {
+                if (this->_gra->has_edge(node, node)) ++loops;
+            }
+            return this->_gra->number_of_edges() - loops;
+        }
+
+        /** @brief Check if there are no edges to report */
+        auto empty() const -> bool { return this->begin() == this->end(); }
+
+        /** @brief Check if two views (possibly of different graph types) report
+            the same edges in the same order */
+        template <typename other_t> auto operator==(const EdgeView<other_t>& other) const -> bool {
+            return std::equal(this->begin(), this->end(), other.begin(), other.end());
+        }
+
+        /** @brief Check if two views differ */
+        template <typename other_t> auto operator!=(const EdgeView<other_t>& other) const
+            -> bool {
+            return !(*this == other);
+        }
+
+      private:
+        const graph_t* _gra;
+    };
+
+    namespace detail {
+        /** @brief Detects graphs that count their structural changes through `version()` */
+        template <typename graph_t, typename = void> struct has_version : std::false_type {};
+
+        template <typename graph_t>
+        struct has_version<graph_t, std::void_t<decltype(std::declval<const graph_t&>().version())>>
+            : std::true_type {};
+    }  // namespace detail
+
+    /** @brief DegreeView class - bulk degree queries for an undirected graph
+        @details On first use the degrees of all nodes are gathered into one
+        contiguous array, with their histogram and maximum (O(V) degree()
+        calls); lookups are then array reads. For graphs that count their
+        changes through `version()` (Graph, DenseGraph) the view re-gathers on
+        the next query after a mutation; immutable graphs are gathered once.
+        Removed (tombstoned) nodes read as degree 0 and are left out of the
+        histogram and of nodes_by_degree(). Gathering happens inside const
+        queries, so do not share a view between threads before its first
+        query. Nodes must be integers 0 .. n-1.
+        @tparam graph_t The graph type */
+    template <typename graph_t> class DegreeView {
+      public:
+        using node_t = typename graph_t::node_t;
+        using degree_t = uint32_t;
+
+        explicit DegreeView(const graph_t& gra) : _gra{&gra} {}
+
+        /** @brief Degree of a node (O(1) once gathered) */
+        auto operator[](const node_t& node) const -> size_t { return this->degrees()[node]; }
+
+        /** @brief Degree of every node, indexed by node */
+        auto degrees() const -> const std::vector<degree_t>& {
+            this->_gather();
+            return this->_degree;
+        }
+
+        /** @brief Number of nodes of each degree 0 .. max_degree() */
+        auto histogram() const -> const std::vector<size_t>& {
+            this->_gather();
+            return this->_histogram;
+        }
+
+        /** @brief Largest degree (0 for a graph without edges) */
+        auto max_degree() const -> size_t { return this->histogram().size() - 1; }
+
+        /** @brief Nodes ordered by degree; ties keep ascending node order
+            @details Counting sort over the histogram, O(V + max_degree()).
+            @param[in] descending Largest degree first if true */
+        auto nodes_by_degree(bool descending = true) const -> std::vector<node_t> {
+            const auto& hist = this->histogram();
+            const auto max_deg = hist.size() - 1;
+            std::vector<size_t> start(hist.size() + 1, 0);
+            for (size_t deg = 0; deg != hist.size(); ++deg) {
+                const auto slot = descending ? max_deg - deg : deg;
+                start[deg + 1] = start[deg] + hist[slot];
+            }
+            std::vector<node_t> result(start.back());
+            for (const auto& node : *this->_gra) {
+                if (!this->_gra->contains(node)) continue;
+                const size_t deg = this->_degree[node];
+                result[start[descending ? max_deg - deg : deg]++] = node;
+            }
+            return result;
+        }
+
+        /** @brief Check if the graph has changed since the degrees were gathered */
+        auto is_stale() const -> bool {
+            if (!this->_gathered) return true;
+            if constexpr (detail::has_version<graph_t>::value) {
+                return this->_version != this->_gra->version();
+            } else {
+                return false;
+            }
+        }
+
+      private:
+        auto _gather() const -> void {
+            if (!this->is_stale()) return;
+            this->_degree.clear();
+            this->_histogram.assign(1, 0);
+            for (const auto& node : *this->_gra) {
+                if (size_t{node} >= this->_degree.size()) this->_degree.resize(size_t{node} + 1, 0);
+                if (!this->_gra->contains(node)) continue;
+                const auto deg = static_cast<degree_t>(this->_gra->degree(node));
+                this->_degree[node] = deg;
+                if (deg >= this->_histogram.size()) this->_histogram.resize(deg + 1, 0);
+                ++this->_histogram[deg];
+            }
+            if constexpr (detail::has_version<graph_t>::value) {
+                this->_version = this->_gra->version();
+            }
+            this->_gathered = true;
+        }
+
+        const graph_t* _gra;
+        mutable std::vector<degree_t> _degree{};
+        mutable std::vector<size_t> _histogram{};
+        mutable size_t _version = 0;
+        mutable bool _gathered = false;
+    };
+
     // class NodeDataView: public Set {
     //     /** A DataView class for nodes of a XNetwork Graph
 
@@ -0,0 +1,274 @@
+/**
+ * @file subgraph_view.hpp
+ * @brief Zero-copy filtered views of a graph with bitset node and edge masks
+ *
+ * A SubGraphView shows a subset of the nodes (and, for CsrGraph, of the
+ * edges) of an underlying graph without copying it. Masks are NodeBitsets,
+ * so every filter check is a single bit test. The view exposes the same
+ * read-only surface the templated algorithms use (`node_t`, iteration over
+ * nodes, `operator[]`, `for_each_edge`, `edges()`, `number_of_nodes`, ...),
+ * so a cover or independent set can be computed on, for example, the part of
+ * a graph not yet covered, or one component, without building an induced
+ * subgraph.
+ *
+ * The underlying graph must outlive the view and must not change while the
+ * view is used. The filter factories of filters.h can be turned into a view
+ * with subgraph_view(), which evaluates the predicate once per node.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/edge_index.hpp>
+#include <xnetwork/classes/node_bitset.hpp>
+#include <xnetwork/classes/reportviews.hpp>
+
+namespace xnetwork {
+
+    /** @brief Read-only view of a graph restricted to masked nodes (and edges)
+        @tparam Graph The underlying graph type, with nodes 0 .. n-1 */
+    template <typename Graph> class SubGraphView {
+      public:
+        using node_t = typename Graph::node_t;
+        using Node = node_t;
+        using edge_t = std::pair<node_t, node_t>;
+
+      private:
+        static constexpr bool is_csr = std::is_same_v<Graph, CsrGraph>;
+        using base_iter_t
+            = decltype(std::begin(std::declval<const Graph&>()[std::declval<node_t>()]));
+
+      public:
+        /** @brief Neighbors of a node that pass the node (and edge) masks */
+        class Neighbors {
+          public:
+            /** @brief Forward iterator skipping masked-out neighbors */
+            class const_iterator {
+              public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = node_t;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const node_t*;
+                using reference = const node_t&;
+
+                const_iterator(const SubGraphView* view, base_iter_t iter, base_iter_t last)
+                    : _view{view}, _iter{iter}, _last{last} {
+                    this->_skip();
+                }
+
+                auto operator*() const -> const node_t& { return *this->_iter; }
+
+                auto operator++() -> const_iterator& {
+                    ++this->_iter;
+                    this->_skip();
+                    return *this;
+                }
+
+                auto operator++(int) -> const_iterator {
+                    auto tmp = *this;
+                    ++*this;
+                    return tmp;
+                }
+
+                auto operator==(const const_iterator& other) const -> bool {
+                    return this->_iter == other._iter;
+                }
+
+                auto operator!=(const const_iterator& other) const -> bool {
+                    return !(*this == other);
+                }
+
+              private:
+                auto _skip() -> void {
+                    while (this->_iter != this->_last && !this->_view->_keep(this->_iter)) {
+                        ++this->_iter;
+                    }
+                }
+
+                const SubGraphView* _view;
+                base_iter_t _iter;
+                base_iter_t _last;
+            };
+
+            using iterator = const_iterator;
+
+            Neighbors(const SubGraphView* view, base_iter_t first, base_iter_t last)
+                : _view{view}, _first{first}, _last{last} {}
+
+            auto begin() const -> const_iterator {
+                return {this->_view, this->_first, this->_last};
+            }
+
+            auto end() const -> const_iterator { return {this->_view, this->_last, this->_last}; }
+
+            /** @brief Number of visible neighbors (O(deg)) */
+            auto size() const -> size_t {
+                return static_cast<size_t>(std::distance(this->begin(), this->end()));
+            }
+
+            auto empty() const -> bool { return this->begin() == this->end(); }
+
+            /** @brief Check if a node is a visible neighbor (O(deg)) */
+            auto contains(const node_t& node) const -> bool {
+                for (const auto nbr : *this) {
+                    if (nbr == node) return true;
+                }
+                return false;
+            }
+
+          private:
+            const SubGraphView* _view;
+            base_iter_t _first;
+            base_iter_t _last;
+        };
+
+        using adjlist_t = Neighbors;
+
+        /** @brief View of the subgraph induced by the nodes in `nodes`
+            @param[in] gra The underlying graph
+            @param[in] nodes Visible nodes; its universe must be gra.number_of_nodes() */
+        SubGraphView(const Graph& gra, NodeBitset nodes) : _gra{&gra}, _nodes{std::move(nodes)} {
+            assert(this->_nodes.universe() == gra.number_of_nodes());
+        }
+
+        /** @brief View restricted to masked nodes and masked edges (CsrGraph only)
+            @details Edge checks read the edge id of the arc being visited from
+            the index, so they stay single bit tests.
+            @param[in] gra The underlying graph
+            @param[in] nodes Visible nodes
+            @param[in] index Edge ids of `gra` (built from gra or a copy of it)
+            @param[in] edges Visible edge ids; its universe must be index.number_of_edges() */
+        SubGraphView(const Graph& gra, NodeBitset nodes, const EdgeIndex& index, NodeBitset edges)
+            : _gra{&gra}, _nodes{std::move(nodes)}, _index{&index}, _edges{std::move(edges)} {
+            static_assert(is_csr, "edge masks need the arc positions of a CsrGraph");
+            assert(index.graph().neighbors() == gra.neighbors());
+            assert(this->_edges.universe() == index.number_of_edges());
+        }
+
+        /** @brief The underlying graph */
+        auto graph() const -> const Graph& { return *this->_gra; }
+
+        /** @brief The node mask */
+        auto nodes() const -> const NodeBitset& { return this->_nodes; }
+
+        /** @brief Begin iterator over visible nodes (ascending) */
+        auto begin() const { return this->_nodes.begin(); }
+
+        /** @brief End iterator over visible nodes */
+        auto end() const { return this->_nodes.end(); }
+
+        /** @brief Check if a node is visible */
+        auto contains(const Node& node) const -> bool { return this->_nodes.contains(node); }
+
+        /** @brief Check if a node is visible */
+        auto has_node(const Node& node) const -> bool { return this->_nodes.contains(node); }
+
+        /** @brief Visible neighbors of a visible node */
+        auto operator[](const Node& node) const -> adjlist_t {
+            auto&& row = (*this->_gra)[node];
+            return adjlist_t{this, std::begin(row), std::end(row)};
+        }
+
+        /** @brief Number of visible nodes (O(1)) */
+        auto number_of_nodes() const -> size_t { return this->_nodes.size(); }
+
+        /** @brief Number of visible nodes (same as number_of_nodes) */
+        auto size() const -> size_t { return this->_nodes.size(); }
+
+        /** @brief Number of visible neighbors of a node (O(deg)) */
+        auto degree(const Node& node) const -> size_t { return (*this)[node].size(); }
+
+        /** @brief Number of visible edges, self loops included (O(n + m)) */
+        auto number_of_edges() const -> size_t {
+            size_t count = 0;
+            for (const auto node : this->_nodes) {
+                for (const auto nbr : (*this)[node]) {
+                    if (node <= nbr) ++count;
+                }
+            }
+            return count;
+        }
+
+        /** @brief Check if an edge is visible */
+        auto has_edge(const Node& node_u, const Node& node_v) const -> bool {
+            if (!this->_nodes.contains(node_u) || !this->_nodes.contains(node_v)) return false;
+            if (!this->_gra->has_edge(node_u, node_v)) return false;
+            if constexpr (is_csr) {
+                if (this->_index != nullptr) {
+                    return this->_edges.contains(
+                        static_cast<uint32_t>(this->_index->edge_id(node_u, node_v)));
+                }
+            }
+            return true;
+        }
+
+        /** @brief Lazy view of the visible edges (u, v) with u < v */
+        auto edges() const -> EdgeView<SubGraphView> { return EdgeView<SubGraphView>{*this}; }
+
+        /** @brief Apply a callable to each visible edge (u, v) with u < v
+            @tparam F Callable `void(node_t, node_t)` or similar */
+        template <typename F> auto for_each_edge(F&& func) const -> void {
+            for (const auto node : this->_nodes) {
+                if constexpr (is_csr) {
+                    const auto row = this->_gra->upper(node);
+                    for (auto iter = row.begin(); iter != row.end(); ++iter) {
+                        if (this->_keep(iter)) func(node, *iter);
+                    }
+                } else {
+                    for (const auto nbr : (*this)[node]) {
+                        if (node < nbr) func(node, nbr);
+                    }
+                }
+            }
+        }
+
+        /** @brief Check if the graph is a multigraph */
+        auto is_multigraph() const { return false; }
+
+        /** @brief Check if the graph is directed */
+        auto is_directed() const { return false; }
+
+      private:
+        auto _keep(const base_iter_t& iter) const -> bool {
+            if (!this->_nodes.contains(static_cast<uint32_t>(*iter))) return false;
+            if constexpr (is_csr) {
+                if (this->_index != nullptr) {
+                    const auto pos = static_cast<size_t>(iter - this->_gra->neighbors());
+                    return this->_edges.contains(
+                        static_cast<uint32_t>(this->_index->arc_edge_ids()[pos]));
+                }
+            }
+            return true;
+        }
+
+        const Graph* _gra;
+        NodeBitset _nodes;
+        const EdgeIndex* _index{nullptr};
+        NodeBitset _edges{};
+    };
+
+    /**
+     * @brief Build a SubGraphView from a node predicate, such as the filters of filters.h
+     *
+     * The predicate is evaluated once per node and stored in a NodeBitset, so
+     * later membership checks are bit tests.
+     *
+     * @param gra      the underlying graph (nodes 0 .. n-1)
+     * @param filter   callable `bool(node_t)`, true for visible nodes
+     */
+    template <typename Graph, typename NodeFilter>
+    auto subgraph_view(const Graph& gra, NodeFilter&& filter) -> SubGraphView<Graph> {
+        NodeBitset nodes(gra.number_of_nodes());
+        for (const auto& node : gra) {
+            if (filter(node)) nodes.insert(static_cast<uint32_t>(node));
+        }
+        return SubGraphView<Graph>{gra, std::move(nodes)};
+    }
+
+}  // namespace xnetwork
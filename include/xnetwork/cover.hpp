@@ -17,6 +17,8 @@
 #include <py2cpp/set.hpp>
 #include <utility>
 #include <vector>
+#include <xnetwork/classes/memory_usage.hpp>
+#include <xnetwork/weight_map.hpp>
 
 /**
  * @brief Implements a primal-dual approximation algorithm for covering problems.
@@ -41,17 +43,19 @@
  *   The violator is called repeatedly; each call returns
  *   std::optional<std::vector<NodeType>> - the next violation,
  *   or std::nullopt when exhausted.
- * @tparam WeightMap Weight mapping (mutable)
- * @tparam SolutionSet Set-like container for the solution
+ * @tparam WeightMap Weight mapping (mutable): a py::dict, or a std::vector indexed by node
+ * @tparam SolutionSet Set-like container for the solution (py::set, or NodeBitset for
+ *   dense ids)
  * @param make_violator Factory that creates fresh violators
  * @param weight Weight function for vertices
  * @param soln Solution set (will be modified)
- * @return std::pair<SolutionSet, typename WeightMap::mapped_type> Solution and total primal cost
+ * @return std::pair<SolutionSet, weight_value_t<WeightMap>> Solution and total primal cost
+ * @note Reports its workspace (gaps, solution, violation) to an active WorkspaceProbe.
  */
 template <typename MakeViolator, typename WeightMap, typename SolutionSet>
 auto pd_cover(MakeViolator make_violator, WeightMap& weight, SolutionSet& soln)
-    -> std::pair<SolutionSet, typename WeightMap::mapped_type> {
-    using CostType = typename WeightMap::mapped_type;
+    -> std::pair<SolutionSet, xnetwork::weight_value_t<WeightMap>> {
+    using CostType = xnetwork::weight_value_t<WeightMap>;
     using NodeType = typename SolutionSet::value_type;
 
     CostType total_dual_cost = 0;
@@ -83,6 +87,12 @@ auto pd_cover(MakeViolator make_violator, WeightMap& weight, SolutionSet& soln)
             for (const auto& vtx : violate_set) {
                 gap[vtx] -= min_val;
             }
+
+            xnetwork::WorkspaceProbe::record([&]() {
+                return xnetwork::detail::heap_bytes(gap) + xnetwork::detail::heap_bytes(soln)
+                       + xnetwork::detail::heap_bytes(added_order)
+                       + xnetwork::detail::heap_bytes(violate_set);
+            });
         }
     }
 
@@ -122,18 +132,18 @@ auto pd_cover(MakeViolator make_violator, WeightMap& weight, SolutionSet& soln)
  * @param ugraph Input graph
  * @param weight Weight function
  * @param coverset Cover set (will be modified)
- * @return std::pair<CoverSet, typename WeightMap::mapped_type> Cover set and total weight
+ * @return std::pair<CoverSet, weight_value_t<WeightMap>> Cover set and total weight
  */
 template <typename Graph, typename WeightMap, typename CoverSet>
 auto min_vertex_cover(const Graph& ugraph, WeightMap& weight, CoverSet& coverset)
-    -> std::pair<CoverSet, typename WeightMap::mapped_type>;
+    -> std::pair<CoverSet, xnetwork::weight_value_t<WeightMap>>;
 
 /**
  * @brief Overload without pre-existing coverset
  */
 template <typename Graph, typename WeightMap>
 auto min_vertex_cover(const Graph& ugraph, WeightMap& weight)
-    -> std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type> {
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
     py::set<typename Graph::node_t> coverset{};
     return min_vertex_cover(ugraph, weight, coverset);
 }
@@ -176,6 +186,7 @@ template <typename Node> auto construct_cycle(const py::dict<Node, BFSInfo<Node>
  *                                typename Graph::node_t,
  *                                typename Graph::node_t>>
  *         Vector of (BFS info, parent, child) tuples for each cycle found
+ * @note Reports its workspace (BFS trees held by the result) to an active WorkspaceProbe.
  */
 template <typename Graph, typename CoverSet>
 auto generic_bfs_cycle(const Graph& ugraph, const CoverSet& coverset)
@@ -191,11 +202,11 @@ auto generic_bfs_cycle(const Graph& ugraph, const CoverSet& coverset)
  * @param ugraph Input graph
  * @param weight Weight function
  * @param coverset Cover set (will be modified)
- * @return std::pair<CoverSet, typename WeightMap::mapped_type> Cover set and total weight
+ * @return std::pair<CoverSet, weight_value_t<WeightMap>> Cover set and total weight
  */
 template <typename Graph, typename WeightMap, typename CoverSet>
 auto min_cycle_cover(const Graph& ugraph, WeightMap& weight, CoverSet& coverset)
-    -> std::pair<CoverSet, typename WeightMap::mapped_type> {
+    -> std::pair<CoverSet, xnetwork::weight_value_t<WeightMap>> {
     using node_t = typename Graph::node_t;
 
     // Factory: returns a violator that does a fresh BFS each call
@@ -218,7 +229,7 @@ auto min_cycle_cover(const Graph& ugraph, WeightMap& weight, CoverSet& coverset)
  */
 template <typename Graph, typename WeightMap>
 auto min_cycle_cover(const Graph& ugraph, WeightMap& weight)
-    -> std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type> {
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
     py::set<typename Graph::node_t> coverset{};
     return min_cycle_cover(ugraph, weight, coverset);
 }
@@ -232,18 +243,18 @@ auto min_cycle_cover(const Graph& ugraph, WeightMap& weight)
  * @param ugraph Input graph
  * @param weight Weight function
  * @param coverset Cover set (will be modified)
- * @return std::pair<CoverSet, typename WeightMap::mapped_type> Cover set and total weight
+ * @return std::pair<CoverSet, weight_value_t<WeightMap>> Cover set and total weight
  */
 template <typename Graph, typename WeightMap, typename CoverSet>
 auto min_odd_cycle_cover(const Graph& ugraph, WeightMap& weight, CoverSet& coverset)
-    -> std::pair<CoverSet, typename WeightMap::mapped_type>;
+    -> std::pair<CoverSet, xnetwork::weight_value_t<WeightMap>>;
 
 /**
  * @brief Overload without pre-existing coverset
  */
 template <typename Graph, typename WeightMap>
 auto min_odd_cycle_cover(const Graph& ugraph, WeightMap& weight)
-    -> std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type> {
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
     py::set<typename Graph::node_t> coverset{};
     return min_odd_cycle_cover(ugraph, weight, coverset);
 }
@@ -0,0 +1,193 @@
+/**
+ * @file fingerprint.hpp
+ * @brief Order-independent 128-bit structural fingerprints of graphs, for result caching
+ *
+ * fingerprint() hashes a graph in one streaming pass over its adjacency.
+ * Each edge {u, v} (and, if given, each weight) is mixed into two
+ * independent 64-bit lanes, and the lanes are summed. Addition is
+ * commutative, so the fingerprint depends only on the node count and the
+ * edge set, not on insertion order, adjacency order or graph class: a
+ * SimpleGraph and its CsrGraph get the same fingerprint. Because the sums
+ * can be split, the pass also runs in parallel over node ranges on a
+ * thread_pool.
+ *
+ * The fingerprint is not cryptographic. It is meant as a cache key for
+ * expensive solvers (min_odd_cycle_cover, solve_hadlock_max_cut, ...) in
+ * front of inputs that are often identical to earlier ones. Nodes must be
+ * integers 0 .. n-1.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <xnetwork/thread_pool.hpp>
+
+namespace xnetwork {
+
+    /** @brief 128-bit graph fingerprint; usable as a key of ordered and hashed containers */
+    struct Fingerprint {
+        uint64_t lo = 0;
+        uint64_t hi = 0;
+
+        friend auto operator==(const Fingerprint& lhs, const Fingerprint& rhs) -> bool {
+            return lhs.lo == rhs.lo && lhs.hi == rhs.hi;
+        }
+
+        friend auto operator!=(const Fingerprint& lhs, const Fingerprint& rhs) -> bool {
+            return !(lhs == rhs);
+        }
+
+        friend auto operator<(const Fingerprint& lhs, const Fingerprint& rhs) -> bool {
+            return lhs.hi != rhs.hi ? lhs.hi < rhs.hi : lhs.lo < rhs.lo;
+        }
+    };
+
+    namespace detail {
+        /** @brief MurmurHash3 64-bit finalizer */
+        inline auto fmix64(uint64_t key) -> uint64_t {
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdULL;
+            key ^= key >> 33;
+            key *= 0xc4ceb9fe1a85ec53ULL;
+            key ^= key >> 33;
+            return key;
+        }
+
+        /** @brief Bit pattern of an arithmetic weight (with -0.0 folded into 0.0) */
+        template <typename T> auto weight_bits(const T& value) -> uint64_t {
+            if constexpr (std::is_floating_point_v<T>) {
+                double dval = value == T{} ? 0.0 : static_cast<double>(value);
+                uint64_t bits = 0;
+                std::memcpy(&bits, &dval, sizeof bits);
+                return bits;
+            } else {
+                return static_cast<uint64_t>(value);
+            }
+        }
+
+        /** @brief Running lane sums of a fingerprint pass */
+        struct FingerprintSums {
+            uint64_t lo = 0;
+            uint64_t hi = 0;
+            uint64_t num_edges = 0;
+
+            /** @brief Add an item whose domain tag, key and payload are given */
+            auto add(uint64_t tag, uint64_t key, uint64_t payload) -> void {
+                const auto base = fmix64(key + tag);
+                this->lo += fmix64(base ^ (payload * 0x9e3779b97f4a7c15ULL));
+                this->hi += fmix64((base + 0x632be59bd9b4e019ULL) ^ fmix64(payload + tag));
+            }
+
+            auto operator+=(const FingerprintSums& other) -> FingerprintSums& {
+                this->lo += other.lo;
+                this->hi += other.hi;
+                this->num_edges += other.num_edges;
+                return *this;
+            }
+        };
+
+        constexpr uint64_t edge_tag = 0x5ca1ab1e0ddba11ULL;
+        constexpr uint64_t node_tag = 0x0b5e55edfacade5ULL;
+
+        /** @brief Hash the edges {u, v}, u <= v, of the nodes first .. last-1
+            @tparam Weight std::nullptr_t for no weights, a node weight map
+                    (`weight.at(u)`) or an edge weight callable `weight(u, v)` */
+        template <typename Graph, typename Weight>
+        auto fingerprint_rows(const Graph& gra, const Weight& weight, uint32_t first,
+                              uint32_t last) -> FingerprintSums {
+            constexpr bool no_weight = std::is_same_v<Weight, std::nullptr_t>;
+            constexpr bool edge_weight = std::is_invocable_v<const Weight&, uint32_t, uint32_t>;
+            FingerprintSums sums;
+            for (auto utx = first; utx != last; ++utx) {
+                if constexpr (!no_weight && !edge_weight) {
+                    sums.add(node_tag, utx, weight_bits(weight.at(utx)));
+                }
+                for (const auto vtx : gra[utx]) {
+                    if (static_cast<uint32_t>(vtx) < utx) continue;
+                    const auto key = (uint64_t{utx} << 32) | static_cast<uint32_t>(vtx);
+                    if constexpr (edge_weight) {
+                        sums.add(edge_tag, key, weight_bits(weight(utx, vtx)));
+                    } else {
+                        sums.add(edge_tag, key, 0);
+                    }
+                    ++sums.num_edges;
+                }
+            }
+            return sums;
+        }
+
+        inline auto finish_fingerprint(const FingerprintSums& sums, uint64_t num_nodes)
+            -> Fingerprint {
+            const auto shape = fmix64(num_nodes) ^ fmix64(sums.num_edges + edge_tag);
+            return Fingerprint{fmix64(sums.lo ^ shape), fmix64(sums.hi + shape)};
+        }
+
+        template <typename Graph> auto node_slots(const Graph& gra) -> uint32_t {
+            return static_cast<uint32_t>(std::distance(gra.begin(), gra.end()));
+        }
+    }  // namespace detail
+
+    /**
+     * @brief Fingerprint a graph and, optionally, its weights in one pass
+     *
+     * @param gra      undirected graph with nodes 0 .. n-1
+     * @param weight   nullptr for structure only, a node weight map (py::dict,
+     *                 std::vector, ... read with `at(u)` for every node), or an edge weight
+     *                 callable `weight(u, v)` such as EdgeWeights
+     */
+    template <typename Graph, typename Weight = std::nullptr_t>
+    auto fingerprint(const Graph& gra, const Weight& weight = nullptr) -> Fingerprint {
+        const auto sums = detail::fingerprint_rows(gra, weight, 0, detail::node_slots(gra));
+        return detail::finish_fingerprint(sums, gra.number_of_nodes());
+    }
+
+    /**
+     * @brief Fingerprint a graph on a thread pool; equal to the serial fingerprint()
+     *
+     * The nodes are split into a few ranges per worker, hashed concurrently
+     * and the lane sums added. `gra` and `weight` are only read.
+     *
+     * @param gra      undirected graph with nodes 0 .. n-1
+     * @param pool     workers to run on
+     * @param weight   see fingerprint()
+     */
+    template <typename Graph, typename Weight = std::nullptr_t>
+    auto fingerprint(const Graph& gra, thread_pool& pool, const Weight& weight = nullptr)
+        -> Fingerprint {
+        const auto num_slots = detail::node_slots(gra);
+        const auto num_chunks = static_cast<uint32_t>(pool.size() * 4);
+        if (num_chunks <= 1 || num_slots == 0) return fingerprint(gra, weight);
+        const auto step = (num_slots + num_chunks - 1) / num_chunks;
+
+        std::vector<std::future<detail::FingerprintSums>> futures;
+        for (uint32_t first = 0; first < num_slots; first += step) {
+            const auto last = num_slots - first < step ? num_slots : first + step;
+            futures.push_back(pool.enqueue([&gra, &weight, first, last]() {
+                return detail::fingerprint_rows(gra, weight, first, last);
+            }));
+        }
+        wait_all(futures);  // the tasks borrow `gra` and `weight`
+        detail::FingerprintSums sums;
+        for (auto& future : futures) {
+            sums += future.get();
+        }
+        return detail::finish_fingerprint(sums, gra.number_of_nodes());
+    }
+
+}  // namespace xnetwork
+
+namespace std {
+    /** @brief Hash of a fingerprint, so it can key std::unordered_map */
+    template <> struct hash<xnetwork::Fingerprint> {
+        auto operator()(const xnetwork::Fingerprint& fp) const noexcept -> size_t {
+            return static_cast<size_t>(fp.lo ^ (fp.hi * 0x9e3779b97f4a7c15ULL));
+        }
+    };
+}  // namespace std
@@ -9,9 +9,14 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
 #include <py2cpp/dict.hpp>
 #include <py2cpp/set.hpp>
 #include <utility>
+#include <vector>
+#include <xnetwork/classes/node_bitset.hpp>
+#include <xnetwork/thread_pool.hpp>
+#include <xnetwork/weight_map.hpp>
 
 /**
  * @brief Performs minimum weighted vertex cover using a primal-dual approximation algorithm
@@ -19,27 +24,80 @@
  * This function implements a primal-dual algorithm for minimum weighted vertex cover on a graph.
  *
  * @tparam Graph The graph type
- * @tparam WeightMap The weight map type (mutable mapping from node to weight)
- * @tparam CoverSet The cover set type
+ * @tparam WeightMap The weight map type (py::dict, or std::vector indexed by node)
+ * @tparam CoverSet The cover set type (py::set, or NodeBitset for dense ids)
  * @param ugraph The input graph
  * @param weight The weight function for vertices
  * @param coverset The vertex cover set (will be modified)
- * @return std::pair<CoverSet, typename WeightMap::mapped_type> The cover set and total weight
+ * @return std::pair<CoverSet, weight_value_t<WeightMap>> The cover set and total weight
  */
 template <typename Graph, typename WeightMap, typename CoverSet>
 auto min_vertex_cover_fast(const Graph& ugraph, WeightMap& weight, CoverSet& coverset)
-    -> std::pair<CoverSet, typename WeightMap::mapped_type>;
+    -> std::pair<CoverSet, xnetwork::weight_value_t<WeightMap>>;
 
 /**
  * @brief Overload that creates an empty coverset
  */
 template <typename Graph, typename WeightMap>
 auto min_vertex_cover_fast(const Graph& ugraph, WeightMap& weight)
-    -> std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type> {
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
     py::set<typename Graph::node_t> coverset{};
     return min_vertex_cover_fast(ugraph, weight, coverset);
 }
 
+/**
+ * @brief min_vertex_cover_fast for K weight vectors in one pass over the edges
+ *
+ * Each node keeps K gap lanes side by side (node-major, so the lanes of an
+ * edge's endpoints are two contiguous rows), plus K cover flags. Every edge
+ * is visited once, and all lanes are relaxed together by a branch-free loop
+ * that the compiler can vectorize. Lane k gives exactly what
+ * min_vertex_cover_fast(ugraph, weights[k], coverset) gives with an empty
+ * coverset. Nodes must be integers 0 .. n-1.
+ *
+ * @tparam Graph The graph type
+ * @tparam CostType The weight type
+ * @param ugraph The input graph
+ * @param weights K weight vectors, each indexed by node
+ * @return One (cover, total weight) pair per weight vector
+ */
+template <typename Graph, typename CostType>
+auto min_vertex_cover_fast_batch(const Graph& ugraph,
+                                 const std::vector<std::vector<CostType>>& weights)
+    -> std::vector<std::pair<xnetwork::NodeBitset, CostType>>;
+
+/**
+ * @brief Parallel min_vertex_cover_fast on a thread pool
+ *
+ * Runs the same local-ratio step as min_vertex_cover_fast (an uncovered edge
+ * (u, v) moves the smaller gap of its endpoints onto the cover) with the
+ * edges split over the workers by node range. Each step holds spinlocks on
+ * both endpoints, so every run equals some sequential edge order: the
+ * result is still a 2-approximation with total dual cost <= primal cost,
+ * but which vertices are chosen may differ between runs. Nodes must be
+ * integers 0 .. n-1; `weight` is read once up front, before the workers start.
+ *
+ * @tparam Graph The graph type
+ * @tparam WeightMap The weight map type
+ * @param ugraph The input graph
+ * @param weight The weight function for vertices
+ * @param pool The workers to run on
+ * @return std::pair<py::set<node_t>, weight_value_t<WeightMap>> The cover and its weight
+ */
+template <typename Graph, typename WeightMap>
+auto min_vertex_cover_fast_par(const Graph& ugraph, WeightMap& weight, xnetwork::thread_pool& pool)
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>>;
+
+/**
+ * @brief Overload that runs on a temporary pool of `num_threads` workers
+ */
+template <typename Graph, typename WeightMap>
+auto min_vertex_cover_fast_par(const Graph& ugraph, WeightMap& weight, size_t num_threads)
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
+    xnetwork::thread_pool pool(num_threads);
+    return min_vertex_cover_fast_par(ugraph, weight, pool);
+}
+
 /**
  * @brief Performs minimum weighted maximal independent set using primal-dual algorithm
  *
@@ -53,19 +111,61 @@ auto min_vertex_cover_fast(const Graph& ugraph, WeightMap& weight)
  * @param weight The weight function for vertices
  * @param indset The independent set (will be modified)
  * @param dep The dependent set (will be modified)
- * @return std::pair<IndSet, typename WeightMap::mapped_type> The independent set and total weight
+ * @return std::pair<IndSet, weight_value_t<WeightMap>> The independent set and total weight
  */
 template <typename Graph, typename WeightMap, typename IndSet, typename DepSet>
 auto min_maximal_independant_set(const Graph& ugraph, WeightMap& weight, IndSet& indset,
-                                 DepSet& dep) -> std::pair<IndSet, typename WeightMap::mapped_type>;
+                                 DepSet& dep)
+    -> std::pair<IndSet, xnetwork::weight_value_t<WeightMap>>;
 
 /**
  * @brief Overload that creates empty indset and dep sets
  */
 template <typename Graph, typename WeightMap>
 auto min_maximal_independant_set(const Graph& ugraph, WeightMap& weight)
-    -> std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type> {
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
     py::set<typename Graph::node_t> indset{};
     py::set<typename Graph::node_t> dep{};
     return min_maximal_independant_set(ugraph, weight, indset, dep);
 }
+
+/**
+ * @brief Parallel minimum weighted maximal independent set on a thread pool
+ *
+ * Every node gets the priority (weight class, hash of its id), lighter
+ * first, where a weight class holds the weights within a factor of two. A
+ * node joins the set once all its higher-priority neighbors are out, and
+ * leaves once one of them is in (Blelloch-Fineman-Shun rounds). Each node
+ * has an atomic status byte; only the undecided nodes are revisited in the
+ * next round. The result is the greedy maximal independent set for that
+ * order. It is the same for any number of threads and any schedule. Nodes
+ * must be integers 0 .. n-1, and `weight` is read once up front.
+ *
+ * Quality vs. depth: unlike min_maximal_independant_set(), a node may win
+ * over a neighbor up to twice as light in its own class. In exchange the
+ * order inside a class is random, so the rounds needed are O(log W log n)
+ * with high probability (W the ratio of the largest to the smallest weight).
+ * Strict (weight, hash) priorities would need as many rounds as the longest
+ * path of strictly falling weights, i.e. up to n rounds on a weighted path.
+ *
+ * @tparam Graph The graph type
+ * @tparam WeightMap The weight map type
+ * @param ugraph The input graph
+ * @param weight The weight function for vertices
+ * @param pool The workers to run on
+ * @return std::pair<py::set<node_t>, weight_value_t<WeightMap>> The set and its weight
+ */
+template <typename Graph, typename WeightMap>
+auto min_maximal_independant_set_par(const Graph& ugraph, WeightMap& weight,
+                                     xnetwork::thread_pool& pool)
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>>;
+
+/**
+ * @brief Overload that runs on a temporary pool of `num_threads` workers
+ */
+template <typename Graph, typename WeightMap>
+auto min_maximal_independant_set_par(const Graph& ugraph, WeightMap& weight, size_t num_threads)
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
+    xnetwork::thread_pool pool(num_threads);
+    return min_maximal_independant_set_par(ugraph, weight, pool);
+}
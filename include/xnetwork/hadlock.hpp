@@ -24,8 +24,10 @@
 #include <py2cpp/set.hpp>
 #include <queue>
 #include <set>
+#include <type_traits>
 #include <utility>
 #include <vector>
+#include <xnetwork/classes/edge_index.hpp>
 #include <xnetwork/thread_pool.hpp>
 
 // Hash for std::pair - needed by py::set<std::pair<...>> (backed by unordered_set)
@@ -53,6 +55,39 @@ namespace detail {
     // Each face -> dual vertex. Two dual vertices connect if faces share a
     // primal edge. Parallel edges -> only the minimum-weight edge is kept.
     // -------------------------------------------------------------------
+    template <typename Node> using DualBest
+        = std::map<std::pair<int, int>, std::pair<int, std::pair<Node, Node>>>;
+
+    /** Keep primal edge (u, v) of weight w between every pair of its faces if it is
+        the lightest edge seen so far between them */
+    template <typename Node>
+    void relax_dual(DualBest<Node>& best, const std::vector<int>& face_ids, int w, Node u,
+                    Node v) {
+        for (size_t a = 0; a < face_ids.size(); ++a) {
+            for (size_t b = a + 1; b < face_ids.size(); ++b) {
+                int fi = face_ids[a];
+                int fj = face_ids[b];
+                if (fi > fj) std::swap(fi, fj);
+                auto it = best.find({fi, fj});
+                if (it == best.end() || w < it->second.first) {
+                    best[{fi, fj}] = {w, {u, v}};
+                }
+            }
+        }
+    }
+
+    template <typename Node> auto dual_from_best(const DualBest<Node>& best, int n_face)
+        -> std::vector<std::vector<DualEdge<Node>>> {
+        std::vector<std::vector<DualEdge<Node>>> dual(n_face);
+        for (const auto& [key, info] : best) {
+            const auto& [fi, fj] = key;
+            const auto& [w, primal] = info;
+            dual[fi].push_back({fj, w, primal});
+            dual[fj].push_back({fi, w, primal});
+        }
+        return dual;
+    }
+
     /**
      * @brief Build the planar dual graph: faces become vertices, shared primal
      *        edges become edges with equal weight.
@@ -99,32 +134,50 @@ namespace detail {
             }
         }
 
-        std::map<std::pair<int, int>, std::pair<int, std::pair<Node, Node>>> best;
+        DualBest<Node> best;
         for (const auto& [primal_key, face_ids] : edge_face_map) {
             if (face_ids.size() < 2) continue;
             const auto& [u, v] = primal_key;
-            const int w = weight(u, v);
-            for (size_t a = 0; a < face_ids.size(); ++a) {
-                for (size_t b = a + 1; b < face_ids.size(); ++b) {
-                    int fi = face_ids[a];
-                    int fj = face_ids[b];
-                    if (fi > fj) std::swap(fi, fj);
-                    auto it = best.find({fi, fj});
-                    if (it == best.end() || w < it->second.first) {
-                        best[{fi, fj}] = {w, {u, v}};
-                    }
-                }
+            relax_dual<Node>(best, face_ids, weight(u, v), u, v);
+        }
+        return dual_from_best(best, n_face);
+    }
+
+    /**
+     * @brief build_dual() for weights in an edge-id-addressed column.
+     *
+     * The faces of each primal edge are bucketed by edge id instead of in a
+     * map keyed by (u, v), and each weight is a single indexed load. Edge ids
+     * follow ascending (u, v), so ties are broken as in the generic version.
+     * DualEdge weights are int, so only EdgeWeights<int> is accepted; this
+     * overload is still chosen for other columns, so they fail here instead of
+     * being narrowed through the callable version.
+     */
+    template <typename Node, typename T>
+    auto build_dual(const std::vector<std::vector<Node>>& faces,
+                    const xnetwork::EdgeWeights<T>& weight)
+        -> std::vector<std::vector<DualEdge<Node>>> {
+        static_assert(std::is_same_v<T, int>, "build_dual: dual edge weights are int");
+        const auto& index = weight.index();
+        const auto n_face = static_cast<int>(faces.size());
+
+        std::vector<std::vector<int>> edge_faces(index.number_of_edges());
+        for (int fi = 0; fi < n_face; ++fi) {
+            const auto& f = faces[fi];
+            for (size_t i = 0; i < f.size(); ++i) {
+                const auto eid = index.edge_id(f[i], f[(i + 1) % f.size()]);
+                edge_faces[eid].push_back(fi);
             }
         }
 
-        std::vector<std::vector<DualEdge<Node>>> dual(n_face);
-        for (const auto& [key, info] : best) {
-            const auto& [fi, fj] = key;
-            const auto& [w, primal] = info;
-            dual[fi].push_back({fj, w, primal});
-            dual[fj].push_back({fi, w, primal});
+        DualBest<Node> best;
+        for (size_t eid = 0; eid != edge_faces.size(); ++eid) {
+            if (edge_faces[eid].size() < 2) continue;
+            const auto [u, v] = index.end_points(eid);
+            relax_dual<Node>(best, edge_faces[eid], weight[eid],
+                             static_cast<Node>(u), static_cast<Node>(v));
         }
-        return dual;
+        return dual_from_best(best, n_face);
     }
 
     // -------------------------------------------------------------------
@@ -229,14 +282,14 @@ namespace detail {
      * @enddot
      *
      * @tparam Graph      Graph type
-     * @tparam WeightFunc Callable `(u, v) -> int`
+     * @tparam WeightFunc Callable `(u, v) -> int`, or an EdgeWeights column
      * @param G           Planar graph (or subgraph)
      * @param weight      Edge weight function
      * @param faces       Face boundaries (cyclic node sequences)
      * @return            Set of edges in the maximum cut
      */
     template <typename Graph, typename WeightFunc>
-    auto solve_hadlock_component(const Graph& G, WeightFunc weight,
+    auto solve_hadlock_component(const Graph& G, WeightFunc&& weight,
                                  const std::vector<std::vector<typename Graph::node_t>>& faces)
         -> py::set<std::pair<typename Graph::node_t, typename Graph::node_t>> {
         using node_t = typename Graph::node_t;
@@ -356,12 +409,13 @@ namespace detail {
  * This overload processes the graph as-is (no decomposition).
  *
  * @param G       planar graph (must provide `edges()`, node type `node_t`)
- * @param weight  callable `weight(u, v) -> int`
+ * @param weight  callable `weight(u, v) -> int`, or an EdgeWeights<int> column
+ *                (see edge_index.hpp) whose weights are then read by edge id
  * @param faces   list of faces, each a cyclic node sequence
  * @return        set of edges belonging to the maximum cut
  */
 template <typename Graph, typename WeightFunc>
-auto solve_hadlock_max_cut(const Graph& G, WeightFunc weight,
+auto solve_hadlock_max_cut(const Graph& G, WeightFunc&& weight,
                            const std::vector<std::vector<typename Graph::node_t>>& faces)
     -> py::set<std::pair<typename Graph::node_t, typename Graph::node_t>> {
     return detail::solve_hadlock_component(G, weight, faces);
@@ -376,7 +430,7 @@ auto solve_hadlock_max_cut(const Graph& G, WeightFunc weight,
  * all-pairs shortest paths and MWPM are computed on smaller dual graphs.
  *
  * @param G                planar graph
- * @param weight           callable `weight(u, v) -> int`
+ * @param weight           callable `weight(u, v) -> int`, or an EdgeWeights<int> column
  * @param component_faces  vector of face-lists, one per biconnected
  *                         component.  `component_faces[i]` is the list
  *                         of face-boundary node sequences for the i-th
@@ -384,7 +438,7 @@ auto solve_hadlock_max_cut(const Graph& G, WeightFunc weight,
  * @return                 set of edges belonging to the maximum cut
  */
 template <typename Graph, typename WeightFunc> auto solve_hadlock_max_cut(
-    const Graph& G, WeightFunc weight,
+    const Graph& G, WeightFunc&& weight,
     const std::vector<std::vector<std::vector<typename Graph::node_t>>>& component_faces)
     -> py::set<std::pair<typename Graph::node_t, typename Graph::node_t>> {
     using node_t = typename Graph::node_t;
@@ -405,8 +459,6 @@ template <typename Graph, typename WeightFunc> auto solve_hadlock_max_cut(
         futures.push_back(pool.enqueue([&, i]() -> py::set<edge_t> {
             const auto& comp_faces = component_faces[i];
 
-            auto comp_weight = [&weight](node_t u, node_t v) -> int { return weight(u, v); };
-
             // Extract edges belonging to this component by scanning faces
             std::vector<std::pair<node_t, node_t>> comp_edges;
             for (const auto& face : comp_faces) {
@@ -429,7 +481,7 @@ template <typename Graph, typename WeightFunc> auto solve_hadlock_max_cut(
             };
 
             CompGraph comp_g{comp_edges};
-            return detail::solve_hadlock_component(comp_g, comp_weight, comp_faces);
+            return detail::solve_hadlock_component(comp_g, weight, comp_faces);
         }));
     }
 
@@ -447,7 +499,7 @@ template <typename Graph, typename WeightFunc> auto solve_hadlock_max_cut(
 template <typename Graph, typename WeightFunc> auto validate_max_cut(
     [[maybe_unused]] const Graph& G,
     const py::set<std::pair<typename Graph::node_t, typename Graph::node_t>>& cut_edges,
-    WeightFunc weight) -> std::pair<bool, int> {
+    WeightFunc&& weight) -> std::pair<bool, int> {
     using node_t = typename Graph::node_t;
 
     std::map<node_t, std::vector<node_t>> cut_adj;
@@ -27,6 +27,7 @@
 #include <utility>
 #include <vector>
 #include <xnetwork/thread_pool.hpp>
+#include <xnetwork/weight_map.hpp>
 
 namespace detail {
 
@@ -37,14 +38,15 @@ namespace detail {
      * temporarily removes it; if the cover remains valid, the removal is
      * kept (vertex was redundant).  Otherwise the vertex is restored.
      *
+     * @tparam NodeSet Set of vertices (py::set, NodeBitset, ...)
      * @tparam Node Vertex type
      * @tparam Validator Callable that returns true if current cover is valid
      * @param soln Mutable cover set (modified in place)
      * @param added_order Vertices in order they were added
      * @param is_valid Validation callable
      */
-    template <typename Node, typename Validator>
-    void reverse_delete_cover(py::set<Node>& soln, const std::vector<Node>& added_order,
+    template <typename NodeSet, typename Node, typename Validator>
+    void reverse_delete_cover(NodeSet& soln, const std::vector<Node>& added_order,
                               Validator&& is_valid) {
         for (auto it = added_order.rbegin(); it != added_order.rend(); ++it) {
             soln.erase(*it);
@@ -87,17 +89,17 @@ namespace detail {
  * @enddot
  *
  * @tparam Graph Graph type (requires node_t, edges())
- * @tparam WeightMap Weight map type (requires mapped_type, operator[])
+ * @tparam WeightMap Weight map type (py::dict or std::vector, read with operator[])
  * @tparam RNG Random number generator type
  * @param ugraph Input undirected graph
  * @param weight Vertex weight mapping
  * @param coverset Initial vertex cover (preserved in the result)
- * @return std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type>
+ * @return std::pair<py::set<typename Graph::node_t>, weight_value_t<WeightMap>>
  */
 template <typename Graph, typename WeightMap, typename RNG>
 auto rand_vertex_cover_trial(const Graph& ugraph, const WeightMap& weight,
                              const py::set<typename Graph::node_t>& coverset, RNG& rng)
-    -> std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type>;
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>>;
 
 // -----------------------------------------------------------------------
 // Convenience overload - single trial with seed
@@ -116,7 +118,7 @@ template <typename Graph, typename WeightMap>
 auto rand_vertex_cover(const Graph& ugraph, const WeightMap& weight,
                        std::optional<unsigned int> seed = std::optional<unsigned int>{0},
                        const py::set<typename Graph::node_t>& coverset = {})
-    -> std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type> {
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
     // using node_t = typename Graph::node_t;
 
     if (seed.has_value()) {
@@ -145,10 +147,10 @@ auto rand_vertex_cover(const Graph& ugraph, const WeightMap& weight,
  * @param num_trials Number of independent Monte Carlo trials (default: 64)
  * @param seed Master random seed (default: 0). Trials use seed + index.
  * @param coverset Optional initial cover set (shared by all trials)
- * @return std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type>
+ * @return std::pair<py::set<typename Graph::node_t>, weight_value_t<WeightMap>>
  */
 template <typename Graph, typename WeightMap>
 auto rand_vertex_cover_mt(const Graph& ugraph, const WeightMap& weight,
                           unsigned int num_trials = 64, unsigned int seed = 0,
                           const py::set<typename Graph::node_t>& coverset = {})
-    -> std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type>;
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>>;
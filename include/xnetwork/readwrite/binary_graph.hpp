@@ -0,0 +1,93 @@
+/**
+ * @file binary_graph.hpp
+ * @brief Versioned binary CSR graph file format with zero-copy memory-mapped open
+ *
+ * A file holds a fixed 64-byte header followed by the CSR offsets array, the
+ * neighbors array and an optional per-arc weight column, each aligned to 8
+ * bytes. open_binary_graph() maps the file read-only and returns a CsrGraph
+ * that points straight into the mapping, so opening costs O(1) regardless of
+ * the graph size and processes opening the same file share its page cache.
+ *
+ * Layout (all integers in the writer's native byte order, which is recorded
+ * in the header and checked on open):
+ *
+ *     [ header | offsets: (n + 1) x uint64 | neighbors: m x uint32 | pad |
+ *       weights: m x double (optional) ]
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+
+namespace xnetwork {
+
+    /** @brief On-disk header of a binary graph file (64 bytes) */
+    struct BinaryGraphHeader {
+        static constexpr uint32_t current_version = 1;
+        static constexpr uint32_t byte_order_mark = 0x01020304;
+        static constexpr uint32_t has_weights = 1U << 0;  ///< flag: weight column present
+
+        char magic[8] = {'X', 'N', 'E', 'T', 'C', 'S', 'R', '\0'};
+        uint32_t version = current_version;
+        uint32_t byte_order = byte_order_mark;
+        uint32_t flags = 0;
+        uint32_t reserved = 0;
+        uint64_t num_nodes = 0;      ///< n
+        uint64_t num_arcs = 0;       ///< m = length of the neighbors array (2 x edges - loops)
+        uint64_t num_edges = 0;      ///< number of undirected edges
+        uint64_t weights_pos = 0;    ///< byte position of the weight column (0 if absent)
+        uint64_t file_size = 0;      ///< total size in bytes, for truncation checks
+    };
+
+    static_assert(sizeof(BinaryGraphHeader) == 64, "binary graph header must be 64 bytes");
+
+    /** @brief A graph opened from a binary graph file
+        @details Both members point into the same read-only mapping, which stays
+        alive as long as `graph` or any copy of it exists. */
+    struct MappedGraph {
+        CsrGraph graph;                  ///< Zero-copy CSR view of the file
+        const double* weights{nullptr};  ///< Per-arc weights aligned with neighbors(), or null
+    };
+
+    /**
+     * @brief Write a CSR graph (and optionally a per-arc weight column) to a file.
+     *
+     * @param path     destination file (overwritten)
+     * @param gra      the graph to write
+     * @param weights  nullptr, or one weight per entry of gra.neighbors()
+     * @exception XNetworkError if the file cannot be written
+     */
+    void write_binary_graph(const std::string& path, const CsrGraph& gra,
+                            const std::vector<double>* weights = nullptr);
+
+    /**
+     * @brief Write any graph with dense integer nodes (e.g. SimpleGraph) to a file.
+     *
+     * The graph is frozen into CSR form first; see freeze().
+     */
+    template <typename Graph> void write_binary_graph(const std::string& path, const Graph& gra) {
+        write_binary_graph(path, freeze(gra));
+    }
+
+    /**
+     * @brief Memory-map a binary graph file read-only.
+     *
+     * No data is copied or parsed beyond the header: the returned graph reads
+     * the offsets and neighbors directly from the mapping. Every header field
+     * is checked against the file size, and the first and last offsets against
+     * the arc count, in O(1). The rows themselves are trusted unless `verify`
+     * is set, which scans them in O(n + m) and touches every page of the file.
+     *
+     * @param path    file written by write_binary_graph()
+     * @param verify  also check that every row is sorted and holds node ids < n
+     * @return MappedGraph viewing the file
+     * @exception XNetworkError if the file cannot be opened or mapped, or its
+     *            header is invalid (wrong magic, version, byte order, size,
+     *            counts or positions)
+     */
+    auto open_binary_graph(const std::string& path, bool verify = false) -> MappedGraph;
+
+}  // namespace xnetwork
@@ -0,0 +1,112 @@
+/**
+ * @file edgelist.hpp
+ * @brief Parallel loaders for SNAP, METIS and DIMACS/PACE graph text files
+ *
+ * The file is memory-mapped and split at line boundaries into chunks that
+ * are parsed concurrently on an xnetwork::thread_pool. The per-chunk edge
+ * buffers are then fed, also in parallel, to the shards of a
+ * ConcurrentGraphBuilder, which sorts and dedupes them per node range.
+ *
+ * Supported formats (nodes are returned 0-based in every case):
+ *  - snap:   one "u v" pair per line (extra columns ignored), 0-based ids,
+ *            '#' or '%' comment lines; the node count is max id + 1.
+ *  - metis:  header "n m [fmt [ncon]]", then line i lists the 1-based
+ *            neighbors of node i (with vertex/edge weights per fmt, which
+ *            are skipped); '%' comment lines.
+ *  - dimacs: "p <kind> n m" header, edges as "e u v" (DIMACS) or "u v"
+ *            (PACE "p td"/"p tw"), 1-based ids; 'c' comment lines.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/graph.hpp>
+#include <xnetwork/classes/graph_builder.hpp>
+#include <xnetwork/thread_pool.hpp>
+
+namespace xnetwork {
+
+    /** @brief Text formats understood by parse_edge_list() */
+    enum class EdgeListFormat { snap, metis, dimacs };
+
+    /** @brief Edges parsed from a text file, one buffer per chunk */
+    struct EdgeChunks {
+        using edge_t = std::pair<uint32_t, uint32_t>;
+
+        uint32_t num_nodes = 0;                    ///< Nodes are 0 .. num_nodes-1
+        std::vector<std::vector<edge_t>> chunks{};  ///< Edges in file order, split by chunk
+
+        /** @brief Total number of parsed edges (duplicates included) */
+        auto num_edges() const -> size_t {
+            size_t total = 0;
+            for (const auto& chunk : this->chunks) {
+                total += chunk.size();
+            }
+            return total;
+        }
+    };
+
+    /**
+     * @brief Parse graph text held in memory, in parallel.
+     *
+     * @param text    the file contents
+     * @param format  the text format
+     * @param pool    thread pool the chunks are parsed on
+     * @param min_chunk_bytes  smallest chunk worth a task of its own
+     * @return the parsed edges
+     * @exception XNetworkError on a malformed line or an out-of-range node id
+     */
+    auto parse_edge_list(std::string_view text, EdgeListFormat format, thread_pool& pool,
+                         size_t min_chunk_bytes = size_t{1} << 20) -> EdgeChunks;
+
+    /**
+     * @brief Memory-map a graph text file and parse it in parallel.
+     *
+     * @exception XNetworkError if the file cannot be read or is malformed
+     */
+    auto parse_edge_list_file(const std::string& path, EdgeListFormat format, thread_pool& pool)
+        -> EdgeChunks;
+
+    /**
+     * @brief Load a graph text file into a graph through ConcurrentGraphBuilder.
+     *
+     * @tparam Graph  any graph type ConcurrentGraphBuilder can build (SimpleGraph, CsrGraph, ...)
+     * @param path    the file to read
+     * @param format  the text format
+     * @param pool    thread pool the chunks are parsed on
+     * @return the graph, with parallel and reversed duplicate edges collapsed
+     */
+    template <typename Graph = SimpleGraph>
+    auto read_graph(const std::string& path, EdgeListFormat format, thread_pool& pool) -> Graph {
+        auto parsed = parse_edge_list_file(path, format, pool);
+        ConcurrentGraphBuilder<Graph> builder(parsed.num_nodes, parsed.chunks.size());
+        std::vector<std::future<void>> tasks;
+        for (size_t idx = 0; idx != parsed.chunks.size(); ++idx) {
+            tasks.push_back(pool.enqueue([&, idx]() {
+                auto& shard = builder.shard(idx);
+                shard.reserve(parsed.chunks[idx].size());
+                shard.add_edges_from(parsed.chunks[idx]);
+                parsed.chunks[idx] = {};  // release each buffer as soon as it is consumed
+            }));
+        }
+        wait_all(tasks);  // the tasks borrow `parsed` and `builder`
+        for (auto& task : tasks) {
+            task.get();
+        }
+        return builder.build(pool);
+    }
+
+    /** @brief Load a graph text file using a temporary thread pool */
+    template <typename Graph = SimpleGraph>
+    auto read_graph(const std::string& path, EdgeListFormat format) -> Graph {
+        thread_pool pool;
+        return read_graph<Graph>(path, format, pool);
+    }
+
+}  // namespace xnetwork
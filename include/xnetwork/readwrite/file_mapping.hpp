@@ -0,0 +1,47 @@
+/**
+ * @file file_mapping.hpp
+ * @brief Read-only memory mapping of a whole file (POSIX mmap / Win32 MapViewOfFile)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace xnetwork {
+
+    namespace detail {
+
+        /** @brief Maps a whole file read-only for the lifetime of the object
+            @details An empty file maps to data() == nullptr, size() == 0. */
+        class FileMapping {
+          public:
+            /** @brief Map a file
+                @param[in] path The file to map
+                @exception XNetworkError if the file cannot be opened or mapped */
+            explicit FileMapping(const std::string& path);
+
+            FileMapping(const FileMapping&) = delete;
+            auto operator=(const FileMapping&) -> FileMapping& = delete;
+
+            ~FileMapping();
+
+            /** @brief First byte of the mapping */
+            auto data() const -> const uint8_t* { return static_cast<const uint8_t*>(this->_data); }
+
+            /** @brief Size of the file in bytes */
+            auto size() const -> size_t { return this->_size; }
+
+          private:
+            void _release();
+
+            void* _data = nullptr;
+            size_t _size = 0;
+            void* _file = nullptr;     ///< Win32 file handle (unused on POSIX)
+            void* _mapping = nullptr;  ///< Win32 mapping handle (unused on POSIX)
+        };
+
+    }  // namespace detail
+
+}  // namespace xnetwork
@@ -0,0 +1,169 @@
+/**
+ * @file reorder.hpp
+ * @brief Cache-locality node reordering with mapping of results back to original ids
+ *
+ * Node ids in input files usually carry no locality, so neighbor accesses
+ * during traversal jump around memory. reorder() relabels a graph so that
+ * nodes visited together get nearby ids, and returns the permutation that
+ * translates results computed on the relabeled graph (covers, cuts, tours,
+ * weights) between the two numberings.
+ *
+ * Strategies:
+ *  - rcm:    reverse Cuthill-McKee; BFS from a pseudo-peripheral node of each
+ *            component, visiting neighbors by ascending degree. Minimizes
+ *            bandwidth, which suits BFS-like kernels.
+ *  - degree: nodes sorted by descending degree (stable). Packs the hubs,
+ *            which are touched most often, into the first cache lines.
+ *  - gorder: greedy Gorder (Wei et al., SIGMOD 2016); each next node is the
+ *            one sharing the most neighbors and edges with the last few
+ *            placed nodes, so neighborhoods overlap within a small window.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/graph_builder.hpp>
+
+namespace xnetwork {
+
+    /** @brief Node ordering strategies understood by reorder() */
+    enum class ReorderStrategy { rcm, degree, gorder };
+
+    /** @brief Bijection between original and relabeled node ids */
+    struct Permutation {
+        using node_t = uint32_t;
+
+        std::vector<node_t> new_to_old{};  ///< new_to_old[new id] = original id
+        std::vector<node_t> old_to_new{};  ///< old_to_new[original id] = new id
+
+        /** @brief Number of nodes */
+        auto size() const -> size_t { return this->new_to_old.size(); }
+
+        /** @brief Original id of a relabeled node */
+        auto to_old(node_t node) const -> node_t { return this->new_to_old[node]; }
+
+        /** @brief Relabeled id of an original node */
+        auto to_new(node_t node) const -> node_t { return this->old_to_new[node]; }
+    };
+
+    /** @brief A relabeled graph together with its permutation */
+    template <typename Graph> struct Reordered {
+        Graph graph;       ///< Graph with nodes renumbered
+        Permutation perm;  ///< Translates between graph's ids and the original ids
+    };
+
+    /**
+     * @brief Compute a locality-improving node order for a CSR graph.
+     *
+     * @param gra       the graph
+     * @param strategy  the ordering strategy
+     * @return the permutation; new ids are positions in the order
+     */
+    auto reorder_permutation(const CsrGraph& gra, ReorderStrategy strategy) -> Permutation;
+
+    /**
+     * @brief Compute a locality-improving node order for any graph with dense integer nodes.
+     */
+    template <typename Graph>
+    auto reorder_permutation(const Graph& gra, ReorderStrategy strategy) -> Permutation {
+        return reorder_permutation(freeze(gra), strategy);
+    }
+
+    /**
+     * @brief Relabel a graph for cache locality.
+     *
+     * @tparam Graph    any graph type GraphBuilder can build (SimpleGraph, CsrGraph, ...)
+     * @param gra       the graph; its nodes must be 0 .. n-1
+     * @param strategy  the ordering strategy
+     * @return the relabeled graph and the permutation used
+     */
+    template <typename Graph>
+    auto reorder(const Graph& gra, ReorderStrategy strategy) -> Reordered<Graph> {
+        auto perm = reorder_permutation(gra, strategy);
+        GraphBuilder<Graph> builder(static_cast<uint32_t>(perm.size()));
+        builder.reserve(gra.number_of_edges());
+        for (const auto& node : gra) {
+            for (const auto& nbr : gra[node]) {
+                if (node <= nbr) {
+                    builder.add_edge(perm.to_new(static_cast<uint32_t>(node)),
+                                     perm.to_new(static_cast<uint32_t>(nbr)));
+                }
+            }
+        }
+        return Reordered<Graph>{builder.build(), std::move(perm)};
+    }
+
+    /** @brief Map a node set (e.g. a vertex cover) of the relabeled graph to original ids */
+    template <typename Node>
+    auto map_back(const Permutation& perm, const py::set<Node>& nodes) -> py::set<Node> {
+        py::set<Node> result;
+        result.reserve(nodes.size());
+        for (const auto& node : nodes) {
+            result.insert(static_cast<Node>(perm.to_old(static_cast<uint32_t>(node))));
+        }
+        return result;
+    }
+
+    /** @brief Map a node sequence (e.g. a tour or a cycle) of the relabeled graph to
+        original ids, keeping its order */
+    template <typename Node>
+    auto map_back(const Permutation& perm, const std::vector<Node>& nodes) -> std::vector<Node> {
+        std::vector<Node> result;
+        result.reserve(nodes.size());
+        for (const auto& node : nodes) {
+            result.push_back(static_cast<Node>(perm.to_old(static_cast<uint32_t>(node))));
+        }
+        return result;
+    }
+
+    /** @brief Map an edge list (e.g. a cut) of the relabeled graph to original ids */
+    template <typename Node>
+    auto map_back(const Permutation& perm, const std::vector<std::pair<Node, Node>>& edges)
+        -> std::vector<std::pair<Node, Node>> {
+        std::vector<std::pair<Node, Node>> result;
+        result.reserve(edges.size());
+        for (const auto& [utx, vtx] : edges) {
+            result.emplace_back(static_cast<Node>(perm.to_old(static_cast<uint32_t>(utx))),
+                                static_cast<Node>(perm.to_old(static_cast<uint32_t>(vtx))));
+        }
+        return result;
+    }
+
+    /** @brief Map an edge set (e.g. the cut of solve_hadlock_max_cut()) of the relabeled
+        graph to original ids
+        @details Relabeling can flip an edge's orientation, so each edge is stored as
+        (min, max); the result then equals the cut computed on the original graph. */
+    template <typename Node>
+    auto map_back(const Permutation& perm, const py::set<std::pair<Node, Node>>& edges)
+        -> py::set<std::pair<Node, Node>> {
+        py::set<std::pair<Node, Node>> result;
+        result.reserve(edges.size());
+        for (const auto& [utx, vtx] : edges) {
+            const auto old_u = static_cast<Node>(perm.to_old(static_cast<uint32_t>(utx)));
+            const auto old_v = static_cast<Node>(perm.to_old(static_cast<uint32_t>(vtx)));
+            result.emplace(std::min(old_u, old_v), std::max(old_u, old_v));
+        }
+        return result;
+    }
+
+    /** @brief Carry a node weight map over to the relabeled ids, so that weighted
+        algorithms can run on the reordered graph */
+    template <typename Node, typename T>
+    auto map_forward(const Permutation& perm, const py::dict<Node, T>& weight)
+        -> py::dict<Node, T> {
+        py::dict<Node, T> result;
+        result.reserve(weight.size());
+        for (const auto& [node, value] : weight) {
+            result[static_cast<Node>(perm.to_new(static_cast<uint32_t>(node)))] = value;
+        }
+        return result;
+    }
+
+}  // namespace xnetwork
@@ -29,6 +29,7 @@
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace xnetwork {
 
@@ -93,6 +94,9 @@ namespace xnetwork {
             return future;
         }
 
+        /** Number of worker threads. */
+        size_t size() const { return workers_.size(); }
+
       private:
         void worker_loop() {
             while (true) {
@@ -117,4 +121,20 @@ namespace xnetwork {
         bool stop_;
     };
 
+    /**
+     * Block until every future is ready, without consuming any result.
+     *
+     * Call this before get() on a batch of tasks that borrow caller state
+     * (captured by reference, or views of a buffer the caller owns): a get()
+     * that rethrows would otherwise unwind that state while later tasks of
+     * the batch still run.
+     */
+    template <typename T> void wait_all(const std::vector<std::future<T>>& futures) {
+        for (const auto& future : futures) {
+            if (future.valid()) {
+                future.wait();
+            }
+        }
+    }
+
 }  // namespace xnetwork
@@ -30,6 +30,7 @@
 #include <py2cpp/set.hpp>
 #include <set>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 #include <xnetwork/classes/graph.hpp>
 
@@ -55,12 +56,73 @@ double calculate_total_distance(const std::vector<Node>& path, WeightFunc&& weig
     return dist;
 }
 
+// ---------------------------------------------------------------------------
+// Helper: WeightMatrix
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Dense row-major n x n table of a weight function.
+ *
+ * The complete-graph routines (prim_mst, two_opt, the matching) query every
+ * pair repeatedly. Tabulating the weight once turns each query into a single
+ * indexed load instead of a call into a branchy or hashing callable; the
+ * pair (u, v) is the edge id of the complete graph. The matrix is itself a
+ * callable ``T(u, v)``, so it can be passed as ``weight``. christofides_tsp()
+ * and solve_christofides_2opt_tsp() build one themselves for graphs of up to
+ * detail::max_tabulated_nodes nodes.
+ *
+ * @tparam T  weight type
+ */
+template <typename T = double> class WeightMatrix {
+  public:
+    /**
+     * @brief Tabulate ``weight(u, v)`` for all 0 <= u != v < n (O(n^2) memory).
+     *
+     * The diagonal is never queried; it is stored as 0.
+     */
+    template <typename WeightFunc> WeightMatrix(size_t n, WeightFunc&& weight)
+        : _n{n}, _data(n * n) {
+        for (size_t u = 0; u < n; ++u) {
+            for (size_t v = 0; v < n; ++v) {
+                if (u != v) this->_data[u * n + v] = static_cast<T>(weight(u, v));
+            }
+        }
+    }
+
+    /** @brief Weight of (u, v) */
+    template <typename Node> auto operator()(Node u, Node v) const -> T {
+        return this->_data[static_cast<size_t>(u) * this->_n + static_cast<size_t>(v)];
+    }
+
+    /** @brief Number of nodes n */
+    auto size() const -> size_t { return this->_n; }
+
+  private:
+    size_t _n;
+    std::vector<T> _data;
+};
+
 // ---------------------------------------------------------------------------
 // Internal helpers for the Christofides algorithm
 // ---------------------------------------------------------------------------
 
 namespace detail {
 
+    /// Largest graph whose weights the solvers tabulate into a WeightMatrix
+    /// (2048^2 doubles = 32 MiB); larger graphs query the callable directly.
+    constexpr size_t max_tabulated_nodes = 2048;
+
+    template <typename T> struct is_weight_matrix : std::false_type {};
+    template <typename T> struct is_weight_matrix<WeightMatrix<T>> : std::true_type {};
+
+    /// Tabulate ``weight``, calling it with ``Node`` arguments as the solvers would.
+    template <typename Node, typename WeightFunc>
+    auto tabulate_weight(size_t n, WeightFunc& weight) -> WeightMatrix<double> {
+        return WeightMatrix<double>(n, [&weight](size_t u, size_t v) {
+            return weight(static_cast<Node>(u), static_cast<Node>(v));
+        });
+    }
+
     /**
      * @brief Prim's MST for dense (complete) graphs - O(n^2).
      *
@@ -268,6 +330,11 @@ auto christofides_tsp(const Graph& G, WeightFunc&& weight) -> std::vector<typena
 
     if (n == 0) return {};
     if (n == 1) return {Node{0}, Node{0}};
+    if constexpr (!detail::is_weight_matrix<std::decay_t<WeightFunc>>::value) {
+        if (n <= detail::max_tabulated_nodes) {
+            return christofides_tsp(G, detail::tabulate_weight<Node>(n, weight));
+        }
+    }
 
     // 1. Minimum Spanning Tree
     const auto mst_edges = detail::prim_mst<Node>(n, weight);
@@ -344,16 +411,19 @@ auto two_opt(std::vector<typename Graph::node_t> path, const Graph& G, WeightFun
     while (improved) {
         improved = false;
         for (size_t i = 1; i + 2 < path.size(); ++i) {
+            // w(i-1, i) only changes when the segment starting at i is reversed
+            double w_prev = weight(path[i - 1], path[i]);
             for (size_t j = i + 1; j + 1 < path.size(); ++j) {
                 if (j - i == 1) continue;
 
-                const double delta = -weight(path[i - 1], path[i]) - weight(path[j], path[j + 1])
+                const double delta = -w_prev - weight(path[j], path[j + 1])
                                      + weight(path[i - 1], path[j])
                                      + std::forward<WeightFunc>(weight)(path[i], path[j + 1]);
 
                 if (delta < -1.0e-12) {
                     std::reverse(path.begin() + static_cast<ptrdiff_t>(i),
                                  path.begin() + static_cast<ptrdiff_t>(j + 1));
+                    w_prev = weight(path[i - 1], path[i]);
                     improved = true;
                 }
             }
@@ -394,6 +464,14 @@ auto two_opt(std::vector<typename Graph::node_t> path, const Graph& G, WeightFun
 template <typename Graph, typename WeightFunc>
 auto solve_christofides_2opt_tsp(const Graph& G, WeightFunc&& weight)
     -> std::vector<typename Graph::node_t> {
+    if constexpr (!detail::is_weight_matrix<std::decay_t<WeightFunc>>::value) {
+        const size_t n = G.number_of_nodes();
+        if (n <= detail::max_tabulated_nodes) {
+            // one table serves both the Christofides and the 2-opt phase
+            const auto table = detail::tabulate_weight<typename Graph::node_t>(n, weight);
+            return solve_christofides_2opt_tsp(G, table);
+        }
+    }
     auto path = christofides_tsp(G, std::forward<WeightFunc>(weight));
     if (path.size() <= 3) return path;
     return two_opt(std::move(path), G, weight);
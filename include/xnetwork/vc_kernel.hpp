@@ -0,0 +1,119 @@
+/**
+ * @file vc_kernel.hpp
+ * @brief Kernelization of weighted vertex cover instances
+ *
+ * vertex_cover_kernel() shrinks a weighted vertex cover instance before
+ * min_vertex_cover, min_vertex_cover_fast or any other solver runs on it.
+ * The following reductions are applied until none of them fires:
+ *
+ * - degree 0: an isolated node is never needed;
+ * - degree 1: a pendant v with neighbor u takes u if w(u) <= w(v); otherwise
+ *   v's weight is paid up front and w(u) -= w(v);
+ * - domination: a neighbor u of v is taken if N[v] is contained in N[u] and
+ *   w(u) <= w(v);
+ * - degree 2: for v with non-adjacent neighbors a, b, both are taken if
+ *   w(v) >= w(a) + w(b), and {v, a, b} is folded into a single node of
+ *   weight w(a) + w(b) - w(v) if w(v) >= max(w(a), w(b));
+ * - LP (crown) reduction: the half-integral LP optimum is read off a
+ *   minimum cut of the bipartite double cover. Nodes at 1 are taken and
+ *   nodes at 0 dropped (Nemhauser-Trotter).
+ *
+ * Every reduction preserves an optimal cover: the optimum of the original
+ * equals offset plus the optimum of the kernel. VertexCoverKernel::lift()
+ * maps any cover of the kernel back to a cover of the original graph whose
+ * weight is offset plus the kernel cover's weight, so approximation
+ * guarantees carry over. Weights must be non-negative and nodes must be
+ * integers 0 .. n-1.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <py2cpp/set.hpp>
+#include <vector>
+#include <xnetwork/classes/graph.hpp>
+#include <xnetwork/weight_map.hpp>
+
+/**
+ * @brief One reduction in a kernel's lift record
+ */
+struct KernelStep {
+    enum Kind : uint8_t {
+        take,     ///< `node` is in the cover
+        pendant,  ///< `node` is in the cover iff `keep` is not
+        fold,     ///< `other` is in the cover iff `keep` is; `node` iff `keep` is not
+    };
+
+    Kind kind;
+    uint32_t node;
+    uint32_t keep = 0;
+    uint32_t other = 0;
+};
+
+/**
+ * @brief A reduced weighted vertex cover instance and how to lift its covers
+ *
+ * @tparam CostType The weight type
+ */
+template <typename CostType> struct VertexCoverKernel {
+    xnetwork::SimpleGraph graph{0U};  ///< The kernel, nodes 0 .. k-1
+    std::vector<CostType> weight{};   ///< Kernel node weights (a vector weight map)
+    std::vector<uint32_t> origin{};   ///< Original node each kernel node stands for
+    CostType offset{};                ///< Weight already committed by the reductions
+    std::vector<KernelStep> steps{};  ///< The reductions, in the order applied
+    uint32_t num_original_nodes = 0;  ///< Node count of the original graph
+
+    /**
+     * @brief Map a cover of the kernel back to a cover of the original graph
+     *
+     * @tparam CoverSet Any iterable set of kernel nodes (py::set, NodeBitset, ...)
+     * @param kernel_cover A vertex cover of `graph`
+     * @return A vertex cover of the original graph, of weight offset + w(kernel_cover)
+     */
+    template <typename CoverSet> auto lift(const CoverSet& kernel_cover) const
+        -> py::set<uint32_t> {
+        std::vector<uint8_t> in_cover(this->num_original_nodes, 0);
+        for (const auto node : kernel_cover) {
+            in_cover[this->origin[node]] = 1;
+        }
+        for (auto iter = this->steps.rbegin(); iter != this->steps.rend(); ++iter) {
+            switch (iter->kind) {
+                case KernelStep::take:
+                    in_cover[iter->node] = 1;
+                    break;
+                case KernelStep::pendant:
+                    in_cover[iter->node] = in_cover[iter->keep] ^ 1U;
+                    break;
+                case KernelStep::fold:
+                    in_cover[iter->other] = in_cover[iter->keep];
+                    in_cover[iter->node] = in_cover[iter->keep] ^ 1U;
+                    break;
+            }
+        }
+        py::set<uint32_t> result;
+        for (uint32_t node = 0; node != this->num_original_nodes; ++node) {
+            if (in_cover[node] != 0) result.insert(node);
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Reduce a weighted vertex cover instance to its kernel
+ *
+ * @code
+ * auto kernel = vertex_cover_kernel(ugraph, weight);
+ * xnetwork::NodeBitset kernel_soln(kernel.graph.number_of_nodes());
+ * auto [kernel_cover, cost] = min_vertex_cover(kernel.graph, kernel.weight, kernel_soln);
+ * auto cover = kernel.lift(kernel_cover);  // of weight kernel.offset + cost
+ * @endcode
+ *
+ * @tparam Graph The graph type
+ * @tparam WeightMap The weight map type (py::dict, or std::vector indexed by node)
+ * @param ugraph The input graph, nodes 0 .. n-1
+ * @param weight Non-negative node weights
+ * @return The kernel with its lift record
+ */
+template <typename Graph, typename WeightMap>
+auto vertex_cover_kernel(const Graph& ugraph, const WeightMap& weight)
+    -> VertexCoverKernel<xnetwork::weight_value_t<WeightMap>>;
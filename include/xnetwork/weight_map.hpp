@@ -0,0 +1,54 @@
+/**
+ * @file weight_map.hpp
+ * @brief Node weight maps accepted by the cover and independent set algorithms
+ *
+ * The algorithms read node weights with `weight[node]` and copy them once
+ * into a gap map. A weight map is either keyed (py::dict<node_t, T>, with
+ * mapped_type T) or, for graphs with dense ids 0 .. n-1, a std::vector<T>
+ * indexed by node. With the vector form the gap copy is a single memcpy and
+ * every lookup in the inner loops is an index instead of a hash probe.
+ * weight_value_t names T for either form.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <type_traits>
+#include <vector>
+#include <xnetwork/exception.hpp>
+
+namespace xnetwork {
+
+    /** @brief Weight type of a node weight map
+        @details Keyed maps give their mapped_type, sequences their value_type. */
+    template <typename WeightMap, typename = void> struct weight_traits {
+        using value_type = typename WeightMap::value_type;
+    };
+
+    template <typename WeightMap>
+    struct weight_traits<WeightMap, std::void_t<typename WeightMap::mapped_type>> {
+        using value_type = typename WeightMap::mapped_type;
+    };
+
+    template <typename WeightMap> using weight_value_t =
+        typename weight_traits<WeightMap>::value_type;
+
+    /** @brief Copy a keyed weight map of a graph with nodes 0 .. num_nodes-1 into a vector
+        @details Nodes without an entry get weight T{}.
+        @exception XNetworkError if a key is not in 0 .. num_nodes-1 */
+    template <typename T>
+    auto to_dense_weights(const py::dict<uint32_t, T>& weight, size_t num_nodes)
+        -> std::vector<T> {
+        std::vector<T> result(num_nodes);
+        for (const auto& [node, value] : weight) {
+            if (node >= num_nodes) {
+                throw XNetworkError("weight key is not a node of the graph");
+            }
+            result[node] = value;
+        }
+        return result;
+    }
+
+}  // namespace xnetwork
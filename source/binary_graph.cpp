@@ -0,0 +1,148 @@
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/exception.hpp>
+#include <xnetwork/readwrite/binary_graph.hpp>
+#include <xnetwork/readwrite/file_mapping.hpp>
+
+namespace xnetwork {
+
+    namespace {
+
+        constexpr uint64_t header_size = sizeof(BinaryGraphHeader);
+
+        auto align8(uint64_t pos) -> uint64_t { return (pos + 7) & ~uint64_t{7}; }
+
+        auto neighbors_pos(uint64_t num_nodes) -> uint64_t {
+            return header_size + (num_nodes + 1) * sizeof(CsrGraph::offset_t);
+        }
+
+        // check that the rows are in bounds, sorted and hold valid node ids
+        void verify_arrays(const CsrGraph::offset_t* offsets, const CsrGraph::node_t* neighbors,
+                           uint64_t num_nodes, const std::string& path) {
+            for (uint64_t node = 0; node != num_nodes; ++node) {
+                if (offsets[node] > offsets[node + 1]) {
+                    throw XNetworkError("open_binary_graph: offsets not monotone in " + path);
+                }
+                for (auto pos = offsets[node]; pos != offsets[node + 1]; ++pos) {
+                    if (neighbors[pos] >= num_nodes
+                        || (pos != offsets[node] && neighbors[pos - 1] >= neighbors[pos])) {
+                        throw XNetworkError("open_binary_graph: invalid neighbor row in " + path);
+                    }
+                }
+            }
+        }
+
+    }  // namespace
+
+    void write_binary_graph(const std::string& path, const CsrGraph& gra,
+                            const std::vector<double>* weights) {
+        const auto num_nodes = static_cast<uint64_t>(gra.number_of_nodes());
+        const auto num_arcs = static_cast<uint64_t>(gra.offsets()[num_nodes]);
+        if (weights != nullptr && weights->size() != num_arcs) {
+            throw XNetworkError("write_binary_graph: weight column must have one entry per arc");
+        }
+
+        BinaryGraphHeader header;
+        header.num_nodes = num_nodes;
+        header.num_arcs = num_arcs;
+        header.num_edges = gra.number_of_edges();
+        const auto nbrs_end = neighbors_pos(num_nodes) + num_arcs * sizeof(CsrGraph::node_t);
+        header.file_size = nbrs_end;
+        if (weights != nullptr) {
+            header.flags |= BinaryGraphHeader::has_weights;
+            header.weights_pos = align8(nbrs_end);
+            header.file_size = header.weights_pos + num_arcs * sizeof(double);
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw XNetworkError("write_binary_graph: cannot open " + path);
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(gra.offsets()),
+                  static_cast<std::streamsize>((num_nodes + 1) * sizeof(CsrGraph::offset_t)));
+        out.write(reinterpret_cast<const char*>(gra.neighbors()),
+                  static_cast<std::streamsize>(num_arcs * sizeof(CsrGraph::node_t)));
+        if (weights != nullptr) {
+            const char padding[8] = {};
+            out.write(padding, static_cast<std::streamsize>(header.weights_pos - nbrs_end));
+            out.write(reinterpret_cast<const char*>(weights->data()),
+                      static_cast<std::streamsize>(num_arcs * sizeof(double)));
+        }
+        if (!out) {
+            throw XNetworkError("write_binary_graph: failed writing " + path);
+        }
+    }
+
+    auto open_binary_graph(const std::string& path, bool verify) -> MappedGraph {
+        auto mapping = std::make_shared<const detail::FileMapping>(path);
+        if (mapping->size() < header_size) {
+            throw XNetworkError("open_binary_graph: file too small: " + path);
+        }
+
+        BinaryGraphHeader header;
+        std::memcpy(&header, mapping->data(), sizeof(header));
+        const BinaryGraphHeader expected{};
+        if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0) {
+            throw XNetworkError("open_binary_graph: not a binary graph file: " + path);
+        }
+        if (header.version != BinaryGraphHeader::current_version) {
+            throw XNetworkError("open_binary_graph: unsupported version in " + path);
+        }
+        if (header.byte_order != BinaryGraphHeader::byte_order_mark) {
+            throw XNetworkError("open_binary_graph: byte order mismatch in " + path);
+        }
+        if (header.file_size != mapping->size()) {
+            throw XNetworkError("open_binary_graph: truncated file " + path);
+        }
+        const auto corrupt = [&path](const char* what) {
+            return XNetworkError(std::string("open_binary_graph: corrupt header (") + what
+                                 + ") in " + path);
+        };
+        // every size below is checked before it is used in arithmetic, so that
+        // a hostile header cannot overflow uint64_t into an in-bounds value
+        const auto file_size = header.file_size;
+        if (header.num_nodes > std::numeric_limits<uint32_t>::max()
+            || neighbors_pos(header.num_nodes) > file_size) {
+            throw corrupt("num_nodes");
+        }
+        const auto nbrs_pos = neighbors_pos(header.num_nodes);
+        if (header.num_arcs > (file_size - nbrs_pos) / sizeof(CsrGraph::node_t)) {
+            throw corrupt("num_arcs");
+        }
+        const auto nbrs_end = nbrs_pos + header.num_arcs * sizeof(CsrGraph::node_t);
+        if (header.num_edges > header.num_arcs || header.num_arcs > 2 * header.num_edges) {
+            throw corrupt("num_edges");  // num_arcs == 2 * num_edges - self loops
+        }
+
+        const auto* base = mapping->data();
+        const auto* offsets = reinterpret_cast<const CsrGraph::offset_t*>(base + header_size);
+        if (offsets[0] != 0 || offsets[header.num_nodes] != header.num_arcs) {
+            throw corrupt("offsets");
+        }
+        const auto* neighbors = reinterpret_cast<const CsrGraph::node_t*>(base + nbrs_pos);
+        const double* weights = nullptr;
+        if ((header.flags & BinaryGraphHeader::has_weights) != 0) {
+            if (header.weights_pos % alignof(double) != 0 || header.weights_pos < nbrs_end
+                || header.weights_pos > file_size
+                || header.num_arcs > (file_size - header.weights_pos) / sizeof(double)) {
+                throw corrupt("weights_pos");
+            }
+            weights = reinterpret_cast<const double*>(base + header.weights_pos);
+        }
+        if (verify) {
+            verify_arrays(offsets, neighbors, header.num_nodes, path);
+        }
+        return MappedGraph{
+            CsrGraph{std::move(mapping), static_cast<uint32_t>(header.num_nodes), offsets,
+                     neighbors, static_cast<size_t>(header.num_edges)},
+            weights};
+    }
+
+}  // namespace xnetwork
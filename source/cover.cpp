@@ -7,7 +7,12 @@
 #include <tuple>
 #include <utility>
 #include <vector>
+#include <xnetwork/classes/compressed_graph.hpp>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/dense_graph.hpp>
 #include <xnetwork/classes/graph.hpp>
+#include <xnetwork/classes/node_bitset.hpp>
+#include <xnetwork/classes/subgraph_view.hpp>
 #include <xnetwork/cover.hpp>
 
 // -----------------------------------------------------------------------
@@ -73,6 +78,7 @@ auto generic_bfs_cycle(const Graph& ugraph, const CoverSet& coverset)
                               typename Graph::node_t, typename Graph::node_t>> {
     using node_t = typename Graph::node_t;
     std::vector<std::tuple<py::dict<node_t, BFSInfo<node_t>>, node_t, node_t>> cycles;
+    size_t cycle_info_bytes = 0;  // held by the BFS trees copied into `cycles`
 
     int depth_limit = static_cast<int>(ugraph.number_of_nodes());
 
@@ -105,8 +111,14 @@ auto generic_bfs_cycle(const Graph& ugraph, const CoverSet& coverset)
                 if (succ == child) continue;
 
                 cycles.emplace_back(info, parent, child);
+                cycle_info_bytes += xnetwork::detail::heap_bytes(info);
             }
         }
+
+        xnetwork::WorkspaceProbe::record([&]() {
+            return xnetwork::detail::heap_bytes(info) + xnetwork::detail::heap_bytes(cycles)
+                   + cycle_info_bytes;
+        });
     }
 
     return cycles;
@@ -116,22 +128,42 @@ template auto generic_bfs_cycle<xnetwork::SimpleGraph, py::set<uint32_t>>(
     const xnetwork::SimpleGraph&, const py::set<uint32_t>&)
     -> std::vector<std::tuple<py::dict<uint32_t, BFSInfo<uint32_t>>, uint32_t, uint32_t>>;
 
+template auto generic_bfs_cycle<xnetwork::CsrGraph, py::set<uint32_t>>(const xnetwork::CsrGraph&,
+                                                                       const py::set<uint32_t>&)
+    -> std::vector<std::tuple<py::dict<uint32_t, BFSInfo<uint32_t>>, uint32_t, uint32_t>>;
+
+template auto generic_bfs_cycle<xnetwork::DenseGraph, py::set<uint32_t>>(
+    const xnetwork::DenseGraph&, const py::set<uint32_t>&)
+    -> std::vector<std::tuple<py::dict<uint32_t, BFSInfo<uint32_t>>, uint32_t, uint32_t>>;
+
+template auto generic_bfs_cycle<xnetwork::CompressedGraph, py::set<uint32_t>>(
+    const xnetwork::CompressedGraph&, const py::set<uint32_t>&)
+    -> std::vector<std::tuple<py::dict<uint32_t, BFSInfo<uint32_t>>, uint32_t, uint32_t>>;
+
+template auto generic_bfs_cycle<xnetwork::SimpleGraph, xnetwork::NodeBitset>(
+    const xnetwork::SimpleGraph&, const xnetwork::NodeBitset&)
+    -> std::vector<std::tuple<py::dict<uint32_t, BFSInfo<uint32_t>>, uint32_t, uint32_t>>;
+
+template auto generic_bfs_cycle<xnetwork::CsrGraph, xnetwork::NodeBitset>(
+    const xnetwork::CsrGraph&, const xnetwork::NodeBitset&)
+    -> std::vector<std::tuple<py::dict<uint32_t, BFSInfo<uint32_t>>, uint32_t, uint32_t>>;
+
 // -----------------------------------------------------------------------
 // min_vertex_cover
 // -----------------------------------------------------------------------
 
 template <typename Graph, typename WeightMap, typename CoverSet>
 auto min_vertex_cover(const Graph& ugraph, WeightMap& weight, CoverSet& coverset)
-    -> std::pair<CoverSet, typename WeightMap::mapped_type> {
+    -> std::pair<CoverSet, xnetwork::weight_value_t<WeightMap>> {
     using node_t = typename Graph::node_t;
 
     auto make_violate_graph = [&]() {
-        auto edge_list = ugraph.edges();
-        return [&coverset, edge_list = std::move(edge_list),
-                idx = std::size_t{0}]() mutable -> std::optional<std::vector<node_t>> {
-            while (idx < edge_list.size()) {
-                const auto& [utx, vtx] = edge_list[idx];
-                ++idx;
+        const auto edges = ugraph.edges();  // lazy; nothing is copied per call
+        return [&coverset, iter = edges.begin(),
+                last = edges.end()]() mutable -> std::optional<std::vector<node_t>> {
+            while (iter != last) {
+                const auto [utx, vtx] = *iter;
+                ++iter;
                 if (!coverset.contains(utx) && !coverset.contains(vtx))
                     return std::vector<node_t>{utx, vtx};
             }
@@ -146,13 +178,49 @@ template auto min_vertex_cover<xnetwork::SimpleGraph, py::dict<uint32_t, int>, p
     const xnetwork::SimpleGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&)
     -> std::pair<py::set<uint32_t>, int>;
 
+template auto min_vertex_cover<xnetwork::CsrGraph, py::dict<uint32_t, int>, py::set<uint32_t>>(
+    const xnetwork::CsrGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover<xnetwork::DenseGraph, py::dict<uint32_t, int>, py::set<uint32_t>>(
+    const xnetwork::DenseGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover<xnetwork::CompressedGraph, py::dict<uint32_t, int>,
+                               py::set<uint32_t>>(const xnetwork::CompressedGraph&,
+                                                  py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover<xnetwork::SubGraphView<xnetwork::SimpleGraph>,
+                               py::dict<uint32_t, int>, py::set<uint32_t>>(
+    const xnetwork::SubGraphView<xnetwork::SimpleGraph>&, py::dict<uint32_t, int>&,
+    py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover<xnetwork::SubGraphView<xnetwork::CsrGraph>,
+                               py::dict<uint32_t, int>, py::set<uint32_t>>(
+    const xnetwork::SubGraphView<xnetwork::CsrGraph>&, py::dict<uint32_t, int>&,
+    py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+// dense-id fast path: vector weights, bitset cover
+template auto min_vertex_cover<xnetwork::SimpleGraph, std::vector<int>, py::set<uint32_t>>(
+    const xnetwork::SimpleGraph&, std::vector<int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover<xnetwork::SimpleGraph, std::vector<int>, xnetwork::NodeBitset>(
+    const xnetwork::SimpleGraph&, std::vector<int>&, xnetwork::NodeBitset&)
+    -> std::pair<xnetwork::NodeBitset, int>;
+
+template auto min_vertex_cover<xnetwork::CsrGraph, std::vector<int>, xnetwork::NodeBitset>(
+    const xnetwork::CsrGraph&, std::vector<int>&, xnetwork::NodeBitset&)
+    -> std::pair<xnetwork::NodeBitset, int>;
+
 // -----------------------------------------------------------------------
 // min_odd_cycle_cover
 // -----------------------------------------------------------------------
 
 template <typename Graph, typename WeightMap, typename CoverSet>
 auto min_odd_cycle_cover(const Graph& ugraph, WeightMap& weight, CoverSet& coverset)
-    -> std::pair<CoverSet, typename WeightMap::mapped_type> {
+    -> std::pair<CoverSet, xnetwork::weight_value_t<WeightMap>> {
     using node_t = typename Graph::node_t;
 
     auto make_violate = [&]() {
@@ -178,3 +246,30 @@ template auto min_odd_cycle_cover<xnetwork::SimpleGraph, py::dict<uint32_t, int>
                                   py::set<uint32_t>>(const xnetwork::SimpleGraph&,
                                                      py::dict<uint32_t, int>&, py::set<uint32_t>&)
     -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_odd_cycle_cover<xnetwork::CsrGraph, py::dict<uint32_t, int>, py::set<uint32_t>>(
+    const xnetwork::CsrGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_odd_cycle_cover<xnetwork::DenseGraph, py::dict<uint32_t, int>,
+                                  py::set<uint32_t>>(const xnetwork::DenseGraph&,
+                                                     py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_odd_cycle_cover<xnetwork::CompressedGraph, py::dict<uint32_t, int>,
+                                  py::set<uint32_t>>(const xnetwork::CompressedGraph&,
+                                                     py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+// dense-id fast path: vector weights, bitset cover
+template auto min_odd_cycle_cover<xnetwork::SimpleGraph, std::vector<int>, py::set<uint32_t>>(
+    const xnetwork::SimpleGraph&, std::vector<int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_odd_cycle_cover<xnetwork::SimpleGraph, std::vector<int>, xnetwork::NodeBitset>(
+    const xnetwork::SimpleGraph&, std::vector<int>&, xnetwork::NodeBitset&)
+    -> std::pair<xnetwork::NodeBitset, int>;
+
+template auto min_odd_cycle_cover<xnetwork::CsrGraph, std::vector<int>, xnetwork::NodeBitset>(
+    const xnetwork::CsrGraph&, std::vector<int>&, xnetwork::NodeBitset&)
+    -> std::pair<xnetwork::NodeBitset, int>;
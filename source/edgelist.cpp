@@ -0,0 +1,325 @@
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <xnetwork/exception.hpp>
+#include <xnetwork/readwrite/edgelist.hpp>
+#include <xnetwork/readwrite/file_mapping.hpp>
+#include <xnetwork/thread_pool.hpp>
+
+namespace xnetwork {
+
+    namespace {
+
+        using edge_t = EdgeChunks::edge_t;
+        using span_t = std::pair<size_t, size_t>;  // [first, last) byte range
+
+        constexpr uint64_t max_node_id = UINT32_MAX - 1;
+
+        /** Tokenizer over one line */
+        class LineCursor {
+          public:
+            explicit LineCursor(std::string_view line)
+                : _ptr{line.data()}, _end{line.data() + line.size()} {}
+
+            /** Skip blanks; true if the line has no more tokens */
+            auto at_end() -> bool {
+                while (this->_ptr != this->_end
+                       && (*this->_ptr == ' ' || *this->_ptr == '\t' || *this->_ptr == '\r')) {
+                    ++this->_ptr;
+                }
+                return this->_ptr == this->_end;
+            }
+
+            /** First non-blank character (the line must not be at_end()) */
+            auto peek() const -> char { return *this->_ptr; }
+
+            auto skip_char() -> void { ++this->_ptr; }
+
+            /** Parse the next unsigned integer token */
+            auto next_uint(uint64_t& value) -> bool {
+                if (this->at_end()) return false;
+                const auto [ptr, ec] = std::from_chars(this->_ptr, this->_end, value);
+                if (ec != std::errc{}) return false;
+                this->_ptr = ptr;
+                return true;
+            }
+
+            /** Skip the next token of any kind */
+            auto skip_token() -> void {
+                this->at_end();
+                while (this->_ptr != this->_end && *this->_ptr != ' ' && *this->_ptr != '\t'
+                       && *this->_ptr != '\r') {
+                    ++this->_ptr;
+                }
+            }
+
+          private:
+            const char* _ptr;
+            const char* _end;
+        };
+
+        /** Call func(line) for every line in text[span.first, span.second) */
+        template <typename F> void for_each_line(std::string_view text, span_t span, F&& func) {
+            auto pos = span.first;
+            while (pos < span.second) {
+                const auto* nl = static_cast<const char*>(
+                    std::memchr(text.data() + pos, '\n', span.second - pos));
+                const auto stop
+                    = nl == nullptr ? span.second : static_cast<size_t>(nl - text.data());
+                func(text.substr(pos, stop - pos));
+                pos = stop + 1;
+            }
+        }
+
+        /** Split text[first, size) into about num_chunks spans ending at line boundaries */
+        auto split_chunks(std::string_view text, size_t first, size_t num_chunks)
+            -> std::vector<span_t> {
+            std::vector<span_t> spans;
+            const auto length = text.size() - first;
+            auto begin = first;
+            for (size_t idx = 1; idx <= num_chunks && begin < text.size(); ++idx) {
+                auto end = idx == num_chunks ? text.size() : first + length * idx / num_chunks;
+                if (end < begin) end = begin;
+                const auto nl = text.find('\n', end == 0 ? 0 : end - 1);
+                end = nl == std::string_view::npos ? text.size() : nl + 1;
+                spans.emplace_back(begin, end);
+                begin = end;
+            }
+            return spans;
+        }
+
+        [[noreturn]] void malformed(std::string_view line) {
+            throw XNetworkError("parse_edge_list: malformed line: "
+                                + std::string(line.substr(0, 80)));
+        }
+
+        auto is_comment(std::string_view line, std::string_view markers) -> bool {
+            LineCursor cursor{line};
+            return !cursor.at_end() && markers.find(cursor.peek()) != std::string_view::npos;
+        }
+
+        /** Position just past the header line; stores the header's integers in `fields`
+            @details Stops at the header, so only the leading comment lines are scanned. */
+        auto read_header(std::string_view text, std::string_view comments, bool dimacs,
+                         std::vector<uint64_t>& fields) -> size_t {
+            size_t pos = 0;
+            while (pos < text.size()) {
+                auto stop = text.find('\n', pos);
+                if (stop == std::string_view::npos) stop = text.size();
+                const auto line = text.substr(pos, stop - pos);
+                pos = stop + 1;
+                LineCursor cursor{line};
+                if (cursor.at_end() || is_comment(line, comments)) continue;
+                if (dimacs) {
+                    if (cursor.peek() != 'p') malformed(line);
+                    cursor.skip_token();  // "p"
+                    cursor.skip_token();  // problem kind: td, tw, edge, ...
+                }
+                uint64_t value = 0;
+                while (cursor.next_uint(value)) {
+                    fields.push_back(value);
+                }
+                if (!cursor.at_end() || fields.size() < 2) malformed(line);
+                return std::min(pos, text.size());
+            }
+            throw XNetworkError("parse_edge_list: missing header line");
+        }
+
+        auto parse_snap(std::string_view text, span_t span, uint64_t& max_id)
+            -> std::vector<edge_t> {
+            std::vector<edge_t> edges;
+            for_each_line(text, span, [&](std::string_view line) {
+                LineCursor cursor{line};
+                if (cursor.at_end() || cursor.peek() == '#' || cursor.peek() == '%') return;
+                uint64_t utx = 0;
+                uint64_t vtx = 0;
+                if (!cursor.next_uint(utx) || !cursor.next_uint(vtx)) malformed(line);
+                if (utx > max_node_id || vtx > max_node_id) malformed(line);
+                max_id = std::max({max_id, utx, vtx});
+                edges.emplace_back(static_cast<uint32_t>(utx), static_cast<uint32_t>(vtx));
+            });
+            return edges;
+        }
+
+        auto parse_dimacs(std::string_view text, span_t span, uint64_t num_nodes)
+            -> std::vector<edge_t> {
+            std::vector<edge_t> edges;
+            for_each_line(text, span, [&](std::string_view line) {
+                LineCursor cursor{line};
+                if (cursor.at_end()) return;
+                const auto lead = cursor.peek();
+                if (lead == 'e') {
+                    cursor.skip_char();
+                } else if (lead < '0' || lead > '9') {
+                    return;  // comment or other descriptor line
+                }
+                uint64_t utx = 0;
+                uint64_t vtx = 0;
+                if (!cursor.next_uint(utx) || !cursor.next_uint(vtx)) malformed(line);
+                if (utx == 0 || vtx == 0 || utx > num_nodes || vtx > num_nodes) malformed(line);
+                edges.emplace_back(static_cast<uint32_t>(utx - 1), static_cast<uint32_t>(vtx - 1));
+            });
+            return edges;
+        }
+
+        struct MetisFormat {
+            bool vertex_sizes = false;
+            unsigned vertex_weights = 0;  // number of weights per vertex
+            bool edge_weights = false;
+        };
+
+        auto count_metis_lines(std::string_view text, span_t span) -> uint64_t {
+            uint64_t count = 0;
+            for_each_line(text, span, [&](std::string_view line) {
+                if (!is_comment(line, "%")) ++count;
+            });
+            return count;
+        }
+
+        auto parse_metis(std::string_view text, span_t span, uint64_t first_node,
+                         uint64_t num_nodes, const MetisFormat& fmt) -> std::vector<edge_t> {
+            std::vector<edge_t> edges;
+            auto node = first_node;
+            for_each_line(text, span, [&](std::string_view line) {
+                if (is_comment(line, "%")) return;
+                LineCursor cursor{line};
+                const auto current = node++;
+                if (current >= num_nodes) {
+                    if (!cursor.at_end()) malformed(line);
+                    return;  // trailing blank lines
+                }
+                if (fmt.vertex_sizes) cursor.skip_token();
+                for (unsigned idx = 0; idx != fmt.vertex_weights; ++idx) {
+                    cursor.skip_token();
+                }
+                uint64_t nbr = 0;
+                while (cursor.next_uint(nbr)) {
+                    if (nbr == 0 || nbr > num_nodes) malformed(line);
+                    edges.emplace_back(static_cast<uint32_t>(current),
+                                       static_cast<uint32_t>(nbr - 1));
+                    if (fmt.edge_weights) cursor.skip_token();
+                }
+                if (!cursor.at_end()) malformed(line);
+            });
+            return edges;
+        }
+
+        /** Results of all tasks; waits for every task before rethrowing the first error,
+            since the tasks read `text` and locals of parse_edge_list() */
+        template <typename T> auto collect(std::vector<std::future<T>>& futures) -> std::vector<T> {
+            wait_all(futures);
+            std::vector<T> results;
+            results.reserve(futures.size());
+            for (auto& future : futures) {
+                results.push_back(future.get());
+            }
+            return results;
+        }
+
+    }  // namespace
+
+    auto parse_edge_list(std::string_view text, EdgeListFormat format, thread_pool& pool,
+                         size_t min_chunk_bytes) -> EdgeChunks {
+        EdgeChunks result;
+        size_t body = 0;
+        std::vector<uint64_t> header;
+        if (format == EdgeListFormat::metis) {
+            body = read_header(text, "%", false, header);
+        } else if (format == EdgeListFormat::dimacs) {
+            body = read_header(text, "c", true, header);
+        }
+        if (!header.empty() && header[0] > max_node_id + 1) {
+            throw XNetworkError("parse_edge_list: too many nodes");
+        }
+
+        const auto body_size = text.size() - body;
+        const auto num_chunks = std::max<size_t>(
+            1, std::min(pool.size() * 4, body_size / std::max<size_t>(min_chunk_bytes, 1)));
+        const auto spans = split_chunks(text, body, num_chunks);
+
+        switch (format) {
+            case EdgeListFormat::snap: {
+                std::vector<std::future<std::pair<std::vector<edge_t>, uint64_t>>> futures;
+                for (const auto& span : spans) {
+                    futures.push_back(pool.enqueue([text, span]() {
+                        uint64_t max_id = 0;
+                        auto edges = parse_snap(text, span, max_id);
+                        return std::make_pair(std::move(edges), max_id);
+                    }));
+                }
+                uint64_t max_id = 0;
+                bool any = false;
+                for (auto& [edges, chunk_max] : collect(futures)) {
+                    any = any || !edges.empty();
+                    max_id = std::max(max_id, chunk_max);
+                    result.chunks.push_back(std::move(edges));
+                }
+                result.num_nodes = any ? static_cast<uint32_t>(max_id + 1) : 0;
+                break;
+            }
+            case EdgeListFormat::dimacs: {
+                const auto num_nodes = header[0];
+                std::vector<std::future<std::vector<edge_t>>> futures;
+                for (const auto& span : spans) {
+                    futures.push_back(pool.enqueue(
+                        [text, span, num_nodes]() { return parse_dimacs(text, span, num_nodes); }));
+                }
+                result.chunks = collect(futures);
+                result.num_nodes = static_cast<uint32_t>(num_nodes);
+                break;
+            }
+            case EdgeListFormat::metis: {
+                const auto num_nodes = header[0];
+                MetisFormat fmt;
+                if (header.size() >= 3) {
+                    const auto code = header[2];  // decimal digits "abc"
+                    fmt.vertex_sizes = (code / 100) % 10 != 0;
+                    fmt.vertex_weights = (code / 10) % 10 != 0 ? 1U : 0U;
+                    fmt.edge_weights = code % 10 != 0;
+                }
+                if (header.size() >= 4 && fmt.vertex_weights != 0) {
+                    fmt.vertex_weights = static_cast<unsigned>(header[3]);
+                }
+
+                // pass 1: node id of the first line of every chunk
+                std::vector<std::future<uint64_t>> counts;
+                for (const auto& span : spans) {
+                    counts.push_back(
+                        pool.enqueue([text, span]() { return count_metis_lines(text, span); }));
+                }
+                std::vector<uint64_t> first_node{0};
+                for (const auto count : collect(counts)) {
+                    first_node.push_back(first_node.back() + count);
+                }
+
+                // pass 2: parse
+                std::vector<std::future<std::vector<edge_t>>> futures;
+                for (size_t idx = 0; idx != spans.size(); ++idx) {
+                    futures.push_back(pool.enqueue([&, idx]() {
+                        return parse_metis(text, spans[idx], first_node[idx], num_nodes, fmt);
+                    }));
+                }
+                result.chunks = collect(futures);
+                result.num_nodes = static_cast<uint32_t>(num_nodes);
+                break;
+            }
+        }
+        return result;
+    }
+
+    auto parse_edge_list_file(const std::string& path, EdgeListFormat format, thread_pool& pool)
+        -> EdgeChunks {
+        const detail::FileMapping mapping{path};
+        const std::string_view text{reinterpret_cast<const char*>(mapping.data()),
+                                    mapping.size()};
+        return parse_edge_list(text, format, pool);
+    }
+
+}  // namespace xnetwork
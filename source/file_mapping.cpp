@@ -0,0 +1,85 @@
+#include <string>
+#include <xnetwork/exception.hpp>
+#include <xnetwork/readwrite/file_mapping.hpp>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace xnetwork {
+
+    namespace detail {
+
+        FileMapping::FileMapping(const std::string& path) {
+#ifdef _WIN32
+            HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                throw XNetworkError("cannot open " + path);
+            }
+            this->_file = file;
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size)) {
+                this->_release();
+                throw XNetworkError("cannot stat " + path);
+            }
+            this->_size = static_cast<size_t>(size.QuadPart);
+            if (this->_size == 0) return;
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            this->_mapping = mapping;
+            if (mapping != nullptr) {
+                this->_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            }
+            if (this->_data == nullptr) {
+                this->_release();
+                throw XNetworkError("cannot map " + path);
+            }
+#else
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw XNetworkError("cannot open " + path);
+            }
+            struct stat info {};
+            if (::fstat(fd, &info) != 0) {
+                ::close(fd);
+                throw XNetworkError("cannot stat " + path);
+            }
+            this->_size = static_cast<size_t>(info.st_size);
+            if (this->_size != 0) {
+                void* addr = ::mmap(nullptr, this->_size, PROT_READ, MAP_SHARED, fd, 0);
+                if (addr == MAP_FAILED) {
+                    ::close(fd);
+                    throw XNetworkError("cannot map " + path);
+                }
+                this->_data = addr;
+            }
+            ::close(fd);  // the mapping keeps the file referenced
+#endif
+        }
+
+        FileMapping::~FileMapping() { this->_release(); }
+
+        void FileMapping::_release() {
+#ifdef _WIN32
+            if (this->_data != nullptr) UnmapViewOfFile(this->_data);
+            if (this->_mapping != nullptr) CloseHandle(static_cast<HANDLE>(this->_mapping));
+            if (this->_file != nullptr) CloseHandle(static_cast<HANDLE>(this->_file));
+            this->_mapping = nullptr;
+            this->_file = nullptr;
+#else
+            if (this->_data != nullptr) ::munmap(this->_data, this->_size);
+#endif
+            this->_data = nullptr;
+        }
+
+    }  // namespace detail
+
+}  // namespace xnetwork
@@ -1,16 +1,32 @@
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <iterator>
 #include <py2cpp/dict.hpp>
 #include <py2cpp/set.hpp>
+#include <thread>
 #include <utility>
+#include <vector>
+#include <xnetwork/classes/arena_graph.hpp>
+#include <xnetwork/classes/compressed_graph.hpp>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/dense_graph.hpp>
+#include <xnetwork/classes/flat_set.hpp>
 #include <xnetwork/classes/graph.hpp>
+#include <xnetwork/classes/node_bitset.hpp>
+#include <xnetwork/classes/subgraph_view.hpp>
 #include <xnetwork/graph_algo.hpp>
+#include <xnetwork/thread_pool.hpp>
 
 template <typename Graph, typename WeightMap, typename IndSet, typename DepSet>
 auto min_maximal_independant_set(const Graph& ugraph, WeightMap& weight, IndSet& indset,
                                  DepSet& dep)
-    -> std::pair<IndSet, typename WeightMap::mapped_type> {
+    -> std::pair<IndSet, xnetwork::weight_value_t<WeightMap>> {
     using node_t = typename Graph::node_t;
-    using CostType = typename WeightMap::mapped_type;
+    using CostType = xnetwork::weight_value_t<WeightMap>;
 
     auto coverset = [&](node_t utx) {
         dep.insert(utx);
@@ -55,14 +71,67 @@ template auto min_maximal_independant_set<xnetwork::SimpleGraph, py::dict<uint32
     const xnetwork::SimpleGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&, py::set<uint32_t>&)
     -> std::pair<py::set<uint32_t>, int>;
 
+template auto min_maximal_independant_set<xnetwork::CsrGraph, py::dict<uint32_t, int>,
+                                          py::set<uint32_t>, py::set<uint32_t>>(
+    const xnetwork::CsrGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_maximal_independant_set<xnetwork::ArenaSimpleGraph, py::dict<uint32_t, int>,
+                                          py::set<uint32_t>, py::set<uint32_t>>(
+    const xnetwork::ArenaSimpleGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&,
+    py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_maximal_independant_set<xnetwork::FlatSimpleGraph, py::dict<uint32_t, int>,
+                                          py::set<uint32_t>, py::set<uint32_t>>(
+    const xnetwork::FlatSimpleGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&,
+    py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_maximal_independant_set<xnetwork::DenseGraph, py::dict<uint32_t, int>,
+                                          py::set<uint32_t>, py::set<uint32_t>>(
+    const xnetwork::DenseGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_maximal_independant_set<xnetwork::CompressedGraph, py::dict<uint32_t, int>,
+                                          py::set<uint32_t>, py::set<uint32_t>>(
+    const xnetwork::CompressedGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&,
+    py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_maximal_independant_set<xnetwork::SubGraphView<xnetwork::SimpleGraph>,
+                                          py::dict<uint32_t, int>, py::set<uint32_t>,
+                                          py::set<uint32_t>>(
+    const xnetwork::SubGraphView<xnetwork::SimpleGraph>&, py::dict<uint32_t, int>&,
+    py::set<uint32_t>&, py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_maximal_independant_set<xnetwork::SubGraphView<xnetwork::CsrGraph>,
+                                          py::dict<uint32_t, int>, py::set<uint32_t>,
+                                          py::set<uint32_t>>(
+    const xnetwork::SubGraphView<xnetwork::CsrGraph>&, py::dict<uint32_t, int>&,
+    py::set<uint32_t>&, py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+// dense-id fast path: vector weights, bitset sets
+template auto min_maximal_independant_set<xnetwork::SimpleGraph, std::vector<int>,
+                                          py::set<uint32_t>, py::set<uint32_t>>(
+    const xnetwork::SimpleGraph&, std::vector<int>&, py::set<uint32_t>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_maximal_independant_set<xnetwork::SimpleGraph, std::vector<int>,
+                                          xnetwork::NodeBitset, xnetwork::NodeBitset>(
+    const xnetwork::SimpleGraph&, std::vector<int>&, xnetwork::NodeBitset&,
+    xnetwork::NodeBitset&) -> std::pair<xnetwork::NodeBitset, int>;
+
+template auto min_maximal_independant_set<xnetwork::CsrGraph, std::vector<int>,
+                                          xnetwork::NodeBitset, xnetwork::NodeBitset>(
+    const xnetwork::CsrGraph&, std::vector<int>&, xnetwork::NodeBitset&, xnetwork::NodeBitset&)
+    -> std::pair<xnetwork::NodeBitset, int>;
+
 // -----------------------------------------------------------------------
 // min_vertex_cover_fast
 // -----------------------------------------------------------------------
 
 template <typename Graph, typename WeightMap, typename CoverSet>
 auto min_vertex_cover_fast(const Graph& ugraph, WeightMap& weight, CoverSet& coverset)
-    -> std::pair<CoverSet, typename WeightMap::mapped_type> {
-    using CostType = typename WeightMap::mapped_type;
+    -> std::pair<CoverSet, xnetwork::weight_value_t<WeightMap>> {
+    using CostType = xnetwork::weight_value_t<WeightMap>;
 
     auto gap = weight;
     CostType total_dual_cost = 0;
@@ -88,3 +157,335 @@ template auto min_vertex_cover_fast<xnetwork::SimpleGraph, py::dict<uint32_t, in
                                     py::set<uint32_t>>(const xnetwork::SimpleGraph&,
                                                        py::dict<uint32_t, int>&, py::set<uint32_t>&)
     -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast<xnetwork::CsrGraph, py::dict<uint32_t, int>, py::set<uint32_t>>(
+    const xnetwork::CsrGraph&, py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast<xnetwork::ArenaSimpleGraph, py::dict<uint32_t, int>,
+                                    py::set<uint32_t>>(const xnetwork::ArenaSimpleGraph&,
+                                                       py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast<xnetwork::FlatSimpleGraph, py::dict<uint32_t, int>,
+                                    py::set<uint32_t>>(const xnetwork::FlatSimpleGraph&,
+                                                       py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast<xnetwork::DenseGraph, py::dict<uint32_t, int>,
+                                    py::set<uint32_t>>(const xnetwork::DenseGraph&,
+                                                       py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast<xnetwork::CompressedGraph, py::dict<uint32_t, int>,
+                                    py::set<uint32_t>>(const xnetwork::CompressedGraph&,
+                                                       py::dict<uint32_t, int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast<xnetwork::SubGraphView<xnetwork::SimpleGraph>,
+                                    py::dict<uint32_t, int>, py::set<uint32_t>>(
+    const xnetwork::SubGraphView<xnetwork::SimpleGraph>&, py::dict<uint32_t, int>&,
+    py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast<xnetwork::SubGraphView<xnetwork::CsrGraph>,
+                                    py::dict<uint32_t, int>, py::set<uint32_t>>(
+    const xnetwork::SubGraphView<xnetwork::CsrGraph>&, py::dict<uint32_t, int>&,
+    py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+// dense-id fast path: vector weights, bitset cover
+template auto min_vertex_cover_fast<xnetwork::SimpleGraph, std::vector<int>, py::set<uint32_t>>(
+    const xnetwork::SimpleGraph&, std::vector<int>&, py::set<uint32_t>&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast<xnetwork::SimpleGraph, std::vector<int>, xnetwork::NodeBitset>(
+    const xnetwork::SimpleGraph&, std::vector<int>&, xnetwork::NodeBitset&)
+    -> std::pair<xnetwork::NodeBitset, int>;
+
+template auto min_vertex_cover_fast<xnetwork::CsrGraph, std::vector<int>, xnetwork::NodeBitset>(
+    const xnetwork::CsrGraph&, std::vector<int>&, xnetwork::NodeBitset&)
+    -> std::pair<xnetwork::NodeBitset, int>;
+
+// -----------------------------------------------------------------------
+// min_vertex_cover_fast_batch
+// -----------------------------------------------------------------------
+
+template <typename Graph, typename CostType>
+auto min_vertex_cover_fast_batch(const Graph& ugraph,
+                                 const std::vector<std::vector<CostType>>& weights)
+    -> std::vector<std::pair<xnetwork::NodeBitset, CostType>> {
+    const auto num_lanes = weights.size();
+    const auto num_slots = static_cast<size_t>(std::distance(ugraph.begin(), ugraph.end()));
+
+    // node-major: the lanes of one node are contiguous
+    std::vector<CostType> gap(num_slots * num_lanes);
+    std::vector<uint8_t> in_cover(num_slots * num_lanes, 0);
+    for (size_t lane = 0; lane != num_lanes; ++lane) {
+        assert(weights[lane].size() >= num_slots);
+        for (size_t node = 0; node != num_slots; ++node) {
+            gap[node * num_lanes + lane] = weights[lane][node];
+        }
+    }
+    std::vector<CostType> total_dual_cost(num_lanes, CostType(0));
+
+    if (num_lanes != 0) {
+        ugraph.for_each_edge([&](auto utx, auto vtx) {
+            auto* gap_u = gap.data() + static_cast<size_t>(utx) * num_lanes;
+            auto* gap_v = gap.data() + static_cast<size_t>(vtx) * num_lanes;
+            auto* cover_u = in_cover.data() + static_cast<size_t>(utx) * num_lanes;
+            auto* cover_v = in_cover.data() + static_cast<size_t>(vtx) * num_lanes;
+            auto* dual = total_dual_cost.data();
+            // branch-free: an inactive lane (edge already covered) moves 0;
+            // on a tie v is covered, as in min_vertex_cover_fast
+            for (size_t lane = 0; lane != num_lanes; ++lane) {
+                const uint8_t active = 1U ^ (cover_u[lane] | cover_v[lane]);
+                const uint8_t take_v = gap_v[lane] <= gap_u[lane] ? 1U : 0U;
+                const CostType step
+                    = active != 0 ? std::min(gap_u[lane], gap_v[lane]) : CostType(0);
+                gap_u[lane] -= step;
+                gap_v[lane] -= step;
+                cover_u[lane] |= active & (1U ^ take_v);
+                cover_v[lane] |= active & take_v;
+                dual[lane] += step;
+            }
+        });
+    }
+
+    std::vector<std::pair<xnetwork::NodeBitset, CostType>> result;
+    result.reserve(num_lanes);
+    for (size_t lane = 0; lane != num_lanes; ++lane) {
+        result.emplace_back(xnetwork::NodeBitset(num_slots), CostType(0));
+    }
+    for (size_t node = 0; node != num_slots; ++node) {
+        const auto* cover_row = in_cover.data() + node * num_lanes;
+        for (size_t lane = 0; lane != num_lanes; ++lane) {
+            if (cover_row[lane] == 0) continue;
+            result[lane].first.insert(static_cast<uint32_t>(node));
+            result[lane].second += weights[lane][node];
+        }
+    }
+
+    for (size_t lane = 0; lane != num_lanes; ++lane) {
+        assert(total_dual_cost[lane] <= result[lane].second);
+    }
+    return result;
+}
+
+template auto min_vertex_cover_fast_batch<xnetwork::SimpleGraph, int>(
+    const xnetwork::SimpleGraph&, const std::vector<std::vector<int>>&)
+    -> std::vector<std::pair<xnetwork::NodeBitset, int>>;
+
+template auto min_vertex_cover_fast_batch<xnetwork::CsrGraph, int>(
+    const xnetwork::CsrGraph&, const std::vector<std::vector<int>>&)
+    -> std::vector<std::pair<xnetwork::NodeBitset, int>>;
+
+// -----------------------------------------------------------------------
+// min_vertex_cover_fast_par
+// -----------------------------------------------------------------------
+
+template <typename Graph, typename WeightMap>
+auto min_vertex_cover_fast_par(const Graph& ugraph, WeightMap& weight, xnetwork::thread_pool& pool)
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
+    using node_t = typename Graph::node_t;
+    using CostType = xnetwork::weight_value_t<WeightMap>;
+
+    // dense copies, so that the workers never touch the (hashing) weight map
+    const auto num_slots = static_cast<size_t>(std::distance(ugraph.begin(), ugraph.end()));
+    std::vector<CostType> gap(num_slots);
+    for (const auto& node : ugraph) gap[node] = weight[node];
+    std::vector<std::atomic<uint8_t>> in_cover(num_slots);
+    std::vector<std::atomic<bool>> locked(num_slots);
+    for (size_t node = 0; node != num_slots; ++node) {
+        in_cover[node].store(0, std::memory_order_relaxed);
+        locked[node].store(false, std::memory_order_relaxed);
+    }
+
+    auto lock = [&locked](node_t node) {
+        while (locked[node].exchange(true, std::memory_order_acquire)) {
+            while (locked[node].load(std::memory_order_relaxed)) std::this_thread::yield();
+        }
+    };
+    auto unlock = [&locked](node_t node) { locked[node].store(false, std::memory_order_release); };
+
+    // one task per node range; gap[] is only touched with both endpoints locked,
+    // taken in ascending id order to avoid deadlock
+    auto relax_rows = [&](size_t first, size_t last) {
+        CostType dual_cost = 0;
+        for (auto utx = static_cast<node_t>(first); utx != last; ++utx) {
+            for (const auto& nbr : ugraph[utx]) {
+                node_t vtx = nbr;
+                if (vtx <= utx) continue;
+                if (in_cover[utx].load(std::memory_order_relaxed) != 0) break;
+                if (in_cover[vtx].load(std::memory_order_relaxed) != 0) continue;
+                lock(utx);
+                lock(vtx);
+                if (in_cover[utx].load(std::memory_order_relaxed) == 0
+                    && in_cover[vtx].load(std::memory_order_relaxed) == 0) {
+                    auto big = utx;
+                    auto small = vtx;
+                    if (gap[big] < gap[small]) std::swap(big, small);
+                    dual_cost += gap[small];
+                    gap[big] -= gap[small];
+                    gap[small] = 0;
+                    in_cover[small].store(1, std::memory_order_relaxed);
+                }
+                unlock(vtx);
+                unlock(utx);
+            }
+        }
+        return dual_cost;
+    };
+
+    const auto num_chunks = pool.size() * 8;
+    const auto step = std::max<size_t>(1, (num_slots + num_chunks - 1) / num_chunks);
+    std::vector<std::future<CostType>> futures;
+    for (size_t first = 0; first < num_slots; first += step) {
+        const auto last = std::min(num_slots, first + step);
+        futures.push_back(pool.enqueue([&relax_rows, first, last]() {
+            return relax_rows(first, last);
+        }));
+    }
+    xnetwork::wait_all(futures);  // the tasks borrow `gap`, `in_cover` and `locked`
+    CostType total_dual_cost = 0;
+    for (auto& future : futures) {
+        total_dual_cost += future.get();
+    }
+
+    py::set<node_t> coverset{};
+    CostType total_prml_cost = 0;
+    for (size_t node = 0; node != num_slots; ++node) {
+        if (in_cover[node].load(std::memory_order_relaxed) == 0) continue;
+        coverset.insert(static_cast<node_t>(node));
+        total_prml_cost += weight[static_cast<node_t>(node)];
+    }
+
+    assert(total_dual_cost <= total_prml_cost);
+    return std::make_pair(coverset, total_prml_cost);
+}
+
+template auto min_vertex_cover_fast_par<xnetwork::SimpleGraph, py::dict<uint32_t, int>>(
+    const xnetwork::SimpleGraph&, py::dict<uint32_t, int>&, xnetwork::thread_pool&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast_par<xnetwork::CsrGraph, py::dict<uint32_t, int>>(
+    const xnetwork::CsrGraph&, py::dict<uint32_t, int>&, xnetwork::thread_pool&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast_par<xnetwork::SimpleGraph, std::vector<int>>(
+    const xnetwork::SimpleGraph&, std::vector<int>&, xnetwork::thread_pool&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_vertex_cover_fast_par<xnetwork::CsrGraph, std::vector<int>>(
+    const xnetwork::CsrGraph&, std::vector<int>&, xnetwork::thread_pool&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+// -----------------------------------------------------------------------
+// min_maximal_independant_set_par
+// -----------------------------------------------------------------------
+
+namespace {
+    /** @brief splitmix64 finalizer: a bijection, so distinct ids never tie */
+    auto priority_hash(uint64_t key) -> uint64_t {
+        key += 0x9e3779b97f4a7c15ULL;
+        key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+        return key ^ (key >> 31);
+    }
+
+    /** @brief Index of the power-of-two band holding `value`, monotone in `value`:
+        weights within a factor of two share a class */
+    auto weight_class(double value) -> int {
+        constexpr int offset = 1100;  // > |ilogb| of any finite double
+        if (value > 0) return offset + std::ilogb(value);
+        if (value < 0) return -offset - std::ilogb(-value);
+        return 0;
+    }
+}  // namespace
+
+template <typename Graph, typename WeightMap>
+auto min_maximal_independant_set_par(const Graph& ugraph, WeightMap& weight,
+                                     xnetwork::thread_pool& pool)
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
+    using node_t = typename Graph::node_t;
+    using CostType = xnetwork::weight_value_t<WeightMap>;
+    enum : uint8_t { undecided, in_set, out_set };
+
+    const auto num_slots = static_cast<size_t>(std::distance(ugraph.begin(), ugraph.end()));
+    std::vector<CostType> node_weight(num_slots);
+    std::vector<std::pair<int, uint64_t>> priority(num_slots);
+    std::vector<node_t> active;
+    active.reserve(num_slots);
+    for (const auto& node : ugraph) {
+        node_weight[node] = weight[node];
+        priority[node] = {weight_class(static_cast<double>(node_weight[node])),
+                          priority_hash(node)};
+        active.push_back(node);
+    }
+    std::vector<std::atomic<uint8_t>> status(num_slots);
+    for (auto& state : status) state.store(undecided, std::memory_order_relaxed);
+
+    // decisions are final and only depend on higher-priority neighbors, so
+    // reading a status early or late never changes the outcome
+    auto try_decide = [&](node_t utx) -> bool {
+        bool all_out = true;
+        for (const auto& nbr : ugraph[utx]) {
+            const node_t vtx = nbr;
+            if (vtx == utx || !(priority[vtx] < priority[utx])) continue;
+            const auto state = status[vtx].load(std::memory_order_acquire);
+            if (state == in_set) {
+                status[utx].store(out_set, std::memory_order_release);
+                return true;
+            }
+            if (state == undecided) all_out = false;
+        }
+        if (all_out) status[utx].store(in_set, std::memory_order_release);
+        return all_out;
+    };
+
+    const auto num_chunks = pool.size() * 8;
+    while (!active.empty()) {
+        const auto step = std::max<size_t>(1024, (active.size() + num_chunks - 1) / num_chunks);
+        std::vector<std::future<std::vector<node_t>>> futures;
+        for (size_t first = 0; first < active.size(); first += step) {
+            const auto last = std::min(active.size(), first + step);
+            futures.push_back(pool.enqueue([&active, &try_decide, first, last]() {
+                std::vector<node_t> rest;
+                for (auto idx = first; idx != last; ++idx) {
+                    if (!try_decide(active[idx])) rest.push_back(active[idx]);
+                }
+                return rest;
+            }));
+        }
+        xnetwork::wait_all(futures);  // the tasks borrow `active` and `try_decide`
+        std::vector<node_t> next;
+        for (auto& future : futures) {
+            const auto rest = future.get();
+            next.insert(next.end(), rest.begin(), rest.end());
+        }
+        active = std::move(next);
+    }
+
+    py::set<node_t> indset{};
+    CostType total_prml_cost = 0;
+    for (size_t node = 0; node != num_slots; ++node) {
+        if (status[node].load(std::memory_order_relaxed) != in_set) continue;
+        indset.insert(static_cast<node_t>(node));
+        total_prml_cost += node_weight[node];
+    }
+    return std::make_pair(indset, total_prml_cost);
+}
+
+template auto min_maximal_independant_set_par<xnetwork::SimpleGraph, py::dict<uint32_t, int>>(
+    const xnetwork::SimpleGraph&, py::dict<uint32_t, int>&, xnetwork::thread_pool&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_maximal_independant_set_par<xnetwork::CsrGraph, py::dict<uint32_t, int>>(
+    const xnetwork::CsrGraph&, py::dict<uint32_t, int>&, xnetwork::thread_pool&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_maximal_independant_set_par<xnetwork::SimpleGraph, std::vector<int>>(
+    const xnetwork::SimpleGraph&, std::vector<int>&, xnetwork::thread_pool&)
+    -> std::pair<py::set<uint32_t>, int>;
+
+template auto min_maximal_independant_set_par<xnetwork::CsrGraph, std::vector<int>>(
+    const xnetwork::CsrGraph&, std::vector<int>&, xnetwork::thread_pool&)
+    -> std::pair<py::set<uint32_t>, int>;
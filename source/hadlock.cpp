@@ -7,6 +7,7 @@
 #include <unordered_set>
 #include <utility>
 #include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
 #include <xnetwork/classes/graph.hpp>
 #include <xnetwork/hadlock.hpp>
 
@@ -197,6 +198,9 @@ namespace detail {
     template auto biconnected_components<xnetwork::SimpleGraph>(const xnetwork::SimpleGraph& G)
         -> std::vector<py::set<typename xnetwork::SimpleGraph::node_t>>;
 
+    template auto biconnected_components<xnetwork::CsrGraph>(const xnetwork::CsrGraph& G)
+        -> std::vector<py::set<typename xnetwork::CsrGraph::node_t>>;
+
     template auto exact_mwpm<uint32_t>(const std::vector<int>&,
                                        const std::vector<std::vector<int>>&)
         -> std::vector<std::pair<int, int>>;
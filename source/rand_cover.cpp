@@ -1,19 +1,27 @@
+#include <algorithm>
 #include <future>
+#include <iterator>
 #include <py2cpp/set.hpp>
 #include <random>
 #include <utility>
 #include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
 #include <xnetwork/classes/graph.hpp>
+#include <xnetwork/classes/node_bitset.hpp>
 #include <xnetwork/rand_cover.hpp>
 
 template <typename Graph, typename WeightMap, typename RNG>
 auto rand_vertex_cover_trial(const Graph& ugraph, const WeightMap& weight,
                              const py::set<typename Graph::node_t>& coverset, RNG& rng)
-    -> std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type> {
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
     using node_t = typename Graph::node_t;
-    using CostType = typename WeightMap::mapped_type;
+    using CostType = xnetwork::weight_value_t<WeightMap>;
 
-    py::set<node_t> soln = coverset.copy();
+    // the trial and its reverse-delete checks probe a bitset over the dense ids
+    size_t universe = static_cast<size_t>(std::distance(ugraph.begin(), ugraph.end()));
+    for (const auto& v : coverset) universe = std::max(universe, size_t{v} + 1);
+    xnetwork::NodeBitset soln(universe);
+    for (const auto& v : coverset) soln.insert(v);
     std::vector<node_t> added_order;
     std::uniform_real_distribution<double> dist(0.0, 1.0);
 
@@ -45,16 +53,33 @@ auto rand_vertex_cover_trial(const Graph& ugraph, const WeightMap& weight,
     };
     detail::reverse_delete_cover(soln, added_order, is_covered);
 
+    py::set<node_t> result;
+    result.reserve(soln.size());
     CostType total_cost{};
-    for (const auto& v : soln) total_cost += weight[v];
+    for (const auto v : soln) {
+        result.insert(v);
+        total_cost += weight[v];
+    }
 
-    return {std::move(soln), total_cost};
+    return {std::move(result), total_cost};
 }
 
 template auto rand_vertex_cover_trial<xnetwork::SimpleGraph, py::dict<uint32_t, int>, std::mt19937>(
     const xnetwork::SimpleGraph&, const py::dict<uint32_t, int>&, const py::set<uint32_t>&,
     std::mt19937&) -> std::pair<py::set<uint32_t>, int>;
 
+template auto rand_vertex_cover_trial<xnetwork::CsrGraph, py::dict<uint32_t, int>, std::mt19937>(
+    const xnetwork::CsrGraph&, const py::dict<uint32_t, int>&, const py::set<uint32_t>&,
+    std::mt19937&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto rand_vertex_cover_trial<xnetwork::SimpleGraph, std::vector<int>, std::mt19937>(
+    const xnetwork::SimpleGraph&, const std::vector<int>&, const py::set<uint32_t>&,
+    std::mt19937&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto rand_vertex_cover_trial<xnetwork::CsrGraph, std::vector<int>, std::mt19937>(
+    const xnetwork::CsrGraph&, const std::vector<int>&, const py::set<uint32_t>&, std::mt19937&)
+    -> std::pair<py::set<uint32_t>, int>;
+
 // -----------------------------------------------------------------------
 // rand_vertex_cover_mt
 // -----------------------------------------------------------------------
@@ -62,9 +87,9 @@ template auto rand_vertex_cover_trial<xnetwork::SimpleGraph, py::dict<uint32_t,
 template <typename Graph, typename WeightMap>
 auto rand_vertex_cover_mt(const Graph& ugraph, const WeightMap& weight, unsigned int num_trials,
                           unsigned int seed, const py::set<typename Graph::node_t>& coverset)
-    -> std::pair<py::set<typename Graph::node_t>, typename WeightMap::mapped_type> {
+    -> std::pair<py::set<typename Graph::node_t>, xnetwork::weight_value_t<WeightMap>> {
     using node_t = typename Graph::node_t;
-    using CostType = typename WeightMap::mapped_type;
+    using CostType = xnetwork::weight_value_t<WeightMap>;
     using Result = std::pair<py::set<node_t>, CostType>;
 
     xnetwork::thread_pool pool;
@@ -90,3 +115,15 @@ auto rand_vertex_cover_mt(const Graph& ugraph, const WeightMap& weight, unsigned
 template auto rand_vertex_cover_mt<xnetwork::SimpleGraph, py::dict<uint32_t, int>>(
     const xnetwork::SimpleGraph&, const py::dict<uint32_t, int>&, unsigned int, unsigned int,
     const py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto rand_vertex_cover_mt<xnetwork::CsrGraph, py::dict<uint32_t, int>>(
+    const xnetwork::CsrGraph&, const py::dict<uint32_t, int>&, unsigned int, unsigned int,
+    const py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto rand_vertex_cover_mt<xnetwork::SimpleGraph, std::vector<int>>(
+    const xnetwork::SimpleGraph&, const std::vector<int>&, unsigned int, unsigned int,
+    const py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
+
+template auto rand_vertex_cover_mt<xnetwork::CsrGraph, std::vector<int>>(
+    const xnetwork::CsrGraph&, const std::vector<int>&, unsigned int, unsigned int,
+    const py::set<uint32_t>&) -> std::pair<py::set<uint32_t>, int>;
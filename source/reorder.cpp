@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <queue>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/reorder.hpp>
+
+namespace xnetwork {
+
+    namespace {
+
+        using node_t = CsrGraph::node_t;
+
+        auto degree_of(const CsrGraph& gra, node_t node) -> size_t {
+            return static_cast<size_t>(gra.offsets()[node + 1] - gra.offsets()[node]);
+        }
+
+        /** Nodes sorted by descending degree, ties by id (counting sort) */
+        auto degree_order(const CsrGraph& gra) -> std::vector<node_t> {
+            const auto num_nodes = static_cast<node_t>(gra.number_of_nodes());
+            size_t max_deg = 0;
+            for (node_t node = 0; node != num_nodes; ++node) {
+                max_deg = std::max(max_deg, degree_of(gra, node));
+            }
+            std::vector<size_t> start(max_deg + 2, 0);
+            for (node_t node = 0; node != num_nodes; ++node) {
+                ++start[max_deg - degree_of(gra, node) + 1];
+            }
+            for (size_t idx = 1; idx != start.size(); ++idx) {
+                start[idx] += start[idx - 1];
+            }
+            std::vector<node_t> order(num_nodes);
+            for (node_t node = 0; node != num_nodes; ++node) {
+                order[start[max_deg - degree_of(gra, node)]++] = node;
+            }
+            return order;
+        }
+
+        /**
+         * BFS from `root` over unvisited nodes, appending to `order` and visiting
+         * neighbors by ascending degree. Returns the number of BFS levels and the
+         * index in `order` where the last level starts.
+         */
+        auto cuthill_mckee_bfs(const CsrGraph& gra, node_t root, std::vector<char>& visited,
+                               std::vector<node_t>& order) -> std::pair<size_t, size_t> {
+            auto head = order.size();
+            auto level_start = head;
+            auto level_end = head + 1;
+            size_t num_levels = 1;
+            order.push_back(root);
+            visited[root] = 1;
+            while (head != order.size()) {
+                if (head == level_end) {
+                    level_start = level_end;
+                    level_end = order.size();
+                    ++num_levels;
+                }
+                const auto node = order[head++];
+                const auto first = order.size();
+                for (const auto nbr : gra[node]) {
+                    if (visited[nbr] == 0) {
+                        visited[nbr] = 1;
+                        order.push_back(nbr);
+                    }
+                }
+                std::stable_sort(order.begin() + static_cast<ptrdiff_t>(first), order.end(),
+                                 [&](node_t lhs, node_t rhs) {
+                                     return degree_of(gra, lhs) < degree_of(gra, rhs);
+                                 });
+            }
+            return {num_levels, level_start};
+        }
+
+        /** Reverse Cuthill-McKee with George-Liu pseudo-peripheral start nodes */
+        auto rcm_order(const CsrGraph& gra) -> std::vector<node_t> {
+            const auto num_nodes = static_cast<node_t>(gra.number_of_nodes());
+            std::vector<char> visited(num_nodes, 0);
+            std::vector<node_t> order;
+            order.reserve(num_nodes);
+            std::vector<node_t> probe;
+
+            // seeds in ascending degree so every component starts from a thin end
+            auto seeds = degree_order(gra);
+            std::reverse(seeds.begin(), seeds.end());
+            for (const auto seed : seeds) {
+                if (visited[seed] != 0) continue;
+
+                // find a pseudo-peripheral node: repeat BFS from the min-degree
+                // node of the last level while the eccentricity grows
+                auto root = seed;
+                size_t eccentricity = 0;
+                for (int round = 0; round != 8; ++round) {
+                    probe.clear();
+                    const auto [num_levels, last_level]
+                        = cuthill_mckee_bfs(gra, root, visited, probe);
+                    for (const auto node : probe) {
+                        visited[node] = 0;  // only probing; keep the cost O(component)
+                    }
+                    if (num_levels <= eccentricity) break;
+                    eccentricity = num_levels;
+                    auto best = probe[last_level];
+                    for (auto idx = last_level; idx != probe.size(); ++idx) {
+                        if (degree_of(gra, probe[idx]) < degree_of(gra, best)) best = probe[idx];
+                    }
+                    root = best;
+                }
+                cuthill_mckee_bfs(gra, root, visited, order);
+            }
+            std::reverse(order.begin(), order.end());
+            return order;
+        }
+
+        /**
+         * Greedy Gorder: place next the unplaced node with the highest score
+         * against the last `window` placed nodes, where a placed node v adds 1
+         * to each neighbor (edge score) and 1 to each neighbor of a neighbor
+         * (shared-neighbor score). Hubs above `hub_degree` are not expanded
+         * for the shared-neighbor score, bounding the update cost.
+         */
+        auto gorder_order(const CsrGraph& gra, size_t window) -> std::vector<node_t> {
+            const auto num_nodes = static_cast<node_t>(gra.number_of_nodes());
+            const auto hub_degree = std::max<size_t>(
+                32, static_cast<size_t>(std::sqrt(static_cast<double>(num_nodes))));
+
+            std::vector<uint32_t> score(num_nodes, 0);
+            std::vector<char> placed(num_nodes, 0);
+            // max-heap on (score, ~node): equal scores pop the smaller id first
+            std::priority_queue<std::pair<uint32_t, uint32_t>> heap;
+
+            auto update = [&](node_t node, bool add) {
+                auto bump = [&](node_t target) {
+                    if (placed[target] != 0) return;
+                    score[target] = add ? score[target] + 1 : score[target] - 1;
+                    if (score[target] != 0) heap.emplace(score[target], ~target);
+                };
+                for (const auto nbr : gra[node]) {
+                    bump(nbr);
+                    if (degree_of(gra, nbr) > hub_degree) continue;
+                    for (const auto sibling : gra[nbr]) {
+                        if (sibling != node) bump(sibling);
+                    }
+                }
+            };
+
+            const auto fallback = degree_order(gra);
+            size_t next_fallback = 0;
+            std::vector<node_t> order;
+            order.reserve(num_nodes);
+            while (order.size() != num_nodes) {
+                node_t node = num_nodes;
+                while (!heap.empty()) {
+                    const auto [key, inv] = heap.top();
+                    heap.pop();
+                    const auto cand = ~inv;
+                    if (placed[cand] == 0 && score[cand] == key) {
+                        node = cand;
+                        break;
+                    }
+                }
+                if (node == num_nodes) {  // nothing scores: start at the biggest unplaced hub
+                    while (placed[fallback[next_fallback]] != 0) ++next_fallback;
+                    node = fallback[next_fallback];
+                }
+                placed[node] = 1;
+                order.push_back(node);
+                update(node, true);
+                if (order.size() > window) {
+                    update(order[order.size() - window - 1], false);
+                }
+            }
+            return order;
+        }
+
+    }  // namespace
+
+    auto reorder_permutation(const CsrGraph& gra, ReorderStrategy strategy) -> Permutation {
+        Permutation perm;
+        switch (strategy) {
+            case ReorderStrategy::rcm:
+                perm.new_to_old = rcm_order(gra);
+                break;
+            case ReorderStrategy::degree:
+                perm.new_to_old = degree_order(gra);
+                break;
+            case ReorderStrategy::gorder:
+                perm.new_to_old = gorder_order(gra, 5);
+                break;
+        }
+        perm.old_to_new.resize(perm.new_to_old.size());
+        for (node_t idx = 0; idx != perm.new_to_old.size(); ++idx) {
+            perm.old_to_new[perm.new_to_old[idx]] = idx;
+        }
+        return perm;
+    }
+
+}  // namespace xnetwork
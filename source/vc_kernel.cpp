@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/graph.hpp>
+#include <xnetwork/vc_kernel.hpp>
+
+namespace {
+
+    /** @brief Dinic max-flow on a small arc list; capacities of type Cap */
+    template <typename Cap> class MaxFlow {
+      public:
+        explicit MaxFlow(uint32_t num_nodes)
+            : _out(num_nodes), _level(num_nodes), _iter(num_nodes) {}
+
+        auto add_arc(uint32_t from, uint32_t to, Cap cap) -> void {
+            this->_out[from].push_back(static_cast<uint32_t>(this->_arcs.size()));
+            this->_arcs.push_back({to, cap});
+            this->_out[to].push_back(static_cast<uint32_t>(this->_arcs.size()));
+            this->_arcs.push_back({from, Cap(0)});
+        }
+
+        /** @brief Saturate all source-sink paths */
+        auto run(uint32_t source, uint32_t sink) -> void {
+            while (this->_bfs(source, sink)) {
+                std::fill(this->_iter.begin(), this->_iter.end(), 0U);
+                this->_blocking_flow(source, sink);
+            }
+        }
+
+        /** @brief After run(): is the node on the source side of the minimum cut? */
+        auto source_side(uint32_t node) const -> bool { return this->_level[node] >= 0; }
+
+      private:
+        struct Arc {
+            uint32_t to;
+            Cap cap;
+        };
+
+        auto _bfs(uint32_t source, uint32_t sink) -> bool {
+            std::fill(this->_level.begin(), this->_level.end(), -1);
+            std::deque<uint32_t> queue{source};
+            this->_level[source] = 0;
+            while (!queue.empty()) {
+                const auto node = queue.front();
+                queue.pop_front();
+                for (const auto arc : this->_out[node]) {
+                    const auto& [to, cap] = this->_arcs[arc];
+                    if (cap <= Cap(0) || this->_level[to] >= 0) continue;
+                    this->_level[to] = this->_level[node] + 1;
+                    queue.push_back(to);
+                }
+            }
+            return this->_level[sink] >= 0;
+        }
+
+        // iterative DFS over the level graph; a path is kept as its arc ids
+        auto _blocking_flow(uint32_t source, uint32_t sink) -> void {
+            std::vector<uint32_t> path;
+            auto node = source;
+            while (true) {
+                if (node == sink) {
+                    auto push = std::numeric_limits<Cap>::max();
+                    for (const auto arc : path) push = std::min(push, this->_arcs[arc].cap);
+                    for (const auto arc : path) {
+                        this->_arcs[arc].cap -= push;
+                        this->_arcs[arc ^ 1U].cap += push;
+                    }
+                    path.clear();
+                    node = source;
+                    continue;
+                }
+                auto& pos = this->_iter[node];
+                const auto& out = this->_out[node];
+                while (pos != out.size()) {
+                    const auto& [to, cap] = this->_arcs[out[pos]];
+                    if (cap > Cap(0) && this->_level[to] == this->_level[node] + 1) break;
+                    ++pos;
+                }
+                if (pos != out.size()) {
+                    path.push_back(out[pos]);
+                    node = this->_arcs[out[pos]].to;
+                    continue;
+                }
+                if (node == source) return;
+                const auto arc = path.back();  // dead end: retreat and skip the arc
+                path.pop_back();
+                node = this->_arcs[arc ^ 1U].to;
+                ++this->_iter[node];
+            }
+        }
+
+        std::vector<Arc> _arcs{};
+        std::vector<std::vector<uint32_t>> _out;
+        std::vector<int> _level;
+        std::vector<size_t> _iter;
+    };
+
+    /** @brief Mutable instance the reductions work on */
+    template <typename CostType> class Reducer {
+      public:
+        Reducer(std::vector<py::set<uint32_t>> adj, std::vector<CostType> weight,
+                VertexCoverKernel<CostType>& kernel)
+            : _adj{std::move(adj)},
+              _weight{std::move(weight)},
+              _alive(this->_adj.size(), 1),
+              _queued(this->_adj.size(), 0),
+              _kernel{kernel} {}
+
+        auto run() -> void {
+            const auto num_nodes = static_cast<uint32_t>(this->_adj.size());
+            for (uint32_t node = 0; node != num_nodes; ++node) {
+                if (this->_adj[node].erase(node) != 0) this->_take(node);  // self-loop
+            }
+            for (uint32_t node = 0; node != num_nodes; ++node) this->_push(node);
+            do {
+                while (!this->_queue.empty()) {
+                    const auto node = this->_queue.front();
+                    this->_queue.pop_front();
+                    this->_queued[node] = 0;
+                    if (this->_alive[node] != 0) this->_reduce(node);
+                }
+            } while (this->_lp_reduce());
+        }
+
+        /** @brief Renumber the surviving nodes 0 .. k-1 into the kernel */
+        auto emit() -> void {
+            auto& kernel = this->_kernel;
+            const auto num_nodes = static_cast<uint32_t>(this->_adj.size());
+            std::vector<uint32_t> index(num_nodes, 0);
+            for (uint32_t node = 0; node != num_nodes; ++node) {
+                if (this->_alive[node] == 0) continue;
+                index[node] = static_cast<uint32_t>(kernel.origin.size());
+                kernel.origin.push_back(node);
+                kernel.weight.push_back(this->_weight[node]);
+            }
+            kernel.graph = xnetwork::SimpleGraph(static_cast<uint32_t>(kernel.origin.size()));
+            for (const auto node : kernel.origin) {
+                for (const auto nbr : this->_adj[node]) {
+                    if (node < nbr) kernel.graph.add_edge(index[node], index[nbr]);
+                }
+            }
+        }
+
+      private:
+        auto _push(uint32_t node) -> void {
+            if (this->_queued[node] != 0) return;
+            this->_queued[node] = 1;
+            this->_queue.push_back(node);
+        }
+
+        // node's weight dropped or N(node) grew: it may now dominate a neighbor
+        auto _push_around(uint32_t node) -> void {
+            for (const auto nbr : this->_adj[node]) this->_push(nbr);
+            this->_push(node);
+        }
+
+        auto _remove(uint32_t node) -> void {
+            for (const auto nbr : this->_adj[node]) {
+                this->_adj[nbr].erase(node);
+                this->_push(nbr);
+            }
+            this->_adj[node].clear();
+            this->_alive[node] = 0;
+        }
+
+        auto _take(uint32_t node) -> void {
+            this->_kernel.offset += this->_weight[node];
+            this->_kernel.steps.push_back({KernelStep::take, node});
+            this->_remove(node);
+        }
+
+        auto _reduce(uint32_t node) -> void {
+            const auto& nbrs = this->_adj[node];
+            const auto& wgt = this->_weight;
+            if (nbrs.empty()) {
+                this->_alive[node] = 0;  // never needed
+                return;
+            }
+            if (nbrs.size() == 1) {
+                const auto nbr = *nbrs.begin();
+                if (wgt[nbr] <= wgt[node]) {
+                    this->_take(nbr);
+                    return;
+                }
+                this->_kernel.offset += wgt[node];
+                this->_weight[nbr] -= wgt[node];
+                this->_kernel.steps.push_back({KernelStep::pendant, node, nbr});
+                this->_remove(node);
+                this->_push_around(nbr);
+                return;
+            }
+            if (nbrs.size() == 2) {
+                auto iter = nbrs.begin();
+                const auto nbr_a = *iter;
+                const auto nbr_b = *++iter;
+                if (!this->_adj[nbr_a].contains(nbr_b)) {
+                    if (wgt[node] - wgt[nbr_a] >= wgt[nbr_b]) {  // no overflow on the sum
+                        this->_take(nbr_a);
+                        this->_take(nbr_b);
+                        return;
+                    }
+                    if (wgt[node] >= std::max(wgt[nbr_a], wgt[nbr_b])) {
+                        this->_fold(node, nbr_a, nbr_b);
+                        return;
+                    }
+                }
+            }
+            // domination: a neighbor whose closed neighborhood contains node's
+            for (const auto nbr : nbrs) {
+                if (wgt[nbr] > wgt[node] || this->_adj[nbr].size() < nbrs.size()) continue;
+                const auto& nbr_adj = this->_adj[nbr];
+                const bool dominates = std::all_of(nbrs.begin(), nbrs.end(), [&](uint32_t other) {
+                    return other == nbr || nbr_adj.contains(other);
+                });
+                if (dominates) {
+                    this->_take(nbr);
+                    return;
+                }
+            }
+        }
+
+        // {node, keep, other} becomes keep, adjacent to N(keep) and N(other)
+        auto _fold(uint32_t node, uint32_t keep, uint32_t other) -> void {
+            this->_kernel.offset += this->_weight[node];
+            this->_weight[keep] += this->_weight[other] - this->_weight[node];
+            this->_kernel.steps.push_back({KernelStep::fold, node, keep, other});
+            this->_remove(node);
+            for (const auto nbr : this->_adj[other]) {
+                this->_adj[nbr].erase(other);
+                this->_adj[nbr].insert(keep);
+                this->_adj[keep].insert(nbr);
+            }
+            this->_adj[other].clear();
+            this->_alive[other] = 0;
+            this->_push_around(keep);
+        }
+
+        // Half-integral LP optimum from a minimum cut of the bipartite double
+        // cover: s -> L(v) and R(v) -> t with capacity w(v), L(u) -> R(v) for
+        // each edge. L(v) on the sink side and R(v) on the source side each
+        // count 1/2 for v.
+        auto _lp_reduce() -> bool {
+            std::vector<uint32_t> nodes;
+            std::vector<uint32_t> index(this->_adj.size(), 0);
+            for (uint32_t node = 0; node != this->_adj.size(); ++node) {
+                if (this->_alive[node] == 0) continue;
+                index[node] = static_cast<uint32_t>(nodes.size());
+                nodes.push_back(node);
+            }
+            if (nodes.empty()) return false;
+            const auto num_nodes = static_cast<uint32_t>(nodes.size());
+            const auto source = 2 * num_nodes;
+            const auto sink = source + 1;
+            MaxFlow<CostType> flow(sink + 1);
+            for (uint32_t idx = 0; idx != num_nodes; ++idx) {
+                flow.add_arc(source, idx, this->_weight[nodes[idx]]);
+                flow.add_arc(num_nodes + idx, sink, this->_weight[nodes[idx]]);
+                for (const auto nbr : this->_adj[nodes[idx]]) {
+                    flow.add_arc(idx, num_nodes + index[nbr], std::numeric_limits<CostType>::max());
+                }
+            }
+            flow.run(source, sink);
+
+            std::vector<uint32_t> ones;
+            std::vector<uint32_t> zeros;
+            for (uint32_t idx = 0; idx != num_nodes; ++idx) {
+                const auto halves = (flow.source_side(idx) ? 0 : 1)
+                                    + (flow.source_side(num_nodes + idx) ? 1 : 0);
+                if (halves == 2) ones.push_back(nodes[idx]);
+                if (halves == 0) zeros.push_back(nodes[idx]);
+            }
+            // all neighbors of a 0 are 1s, so taking the 1s isolates the 0s
+            for (const auto node : ones) this->_take(node);
+            for (const auto node : zeros) {
+                assert(this->_adj[node].empty());
+                this->_alive[node] = 0;
+            }
+            return !ones.empty() || !zeros.empty();
+        }
+
+        std::vector<py::set<uint32_t>> _adj;
+        std::vector<CostType> _weight;
+        std::vector<uint8_t> _alive;
+        std::vector<uint8_t> _queued;
+        std::deque<uint32_t> _queue{};
+        VertexCoverKernel<CostType>& _kernel;
+    };
+
+}  // namespace
+
+template <typename Graph, typename WeightMap>
+auto vertex_cover_kernel(const Graph& ugraph, const WeightMap& weight)
+    -> VertexCoverKernel<xnetwork::weight_value_t<WeightMap>> {
+    using CostType = xnetwork::weight_value_t<WeightMap>;
+
+    const auto num_slots = static_cast<uint32_t>(std::distance(ugraph.begin(), ugraph.end()));
+    std::vector<py::set<uint32_t>> adj(num_slots);
+    std::vector<CostType> dense_weight(num_slots);
+    for (const auto& node : ugraph) {
+        dense_weight[node] = weight[node];
+        assert(dense_weight[node] >= CostType(0));
+        for (const auto& nbr : ugraph[node]) adj[node].insert(static_cast<uint32_t>(nbr));
+    }
+
+    VertexCoverKernel<CostType> kernel;
+    kernel.num_original_nodes = num_slots;
+    Reducer<CostType> reducer(std::move(adj), std::move(dense_weight), kernel);
+    reducer.run();
+    reducer.emit();
+    return kernel;
+}
+
+template auto vertex_cover_kernel<xnetwork::SimpleGraph, py::dict<uint32_t, int>>(
+    const xnetwork::SimpleGraph&, const py::dict<uint32_t, int>&) -> VertexCoverKernel<int>;
+
+template auto vertex_cover_kernel<xnetwork::SimpleGraph, std::vector<int>>(
+    const xnetwork::SimpleGraph&, const std::vector<int>&) -> VertexCoverKernel<int>;
+
+template auto vertex_cover_kernel<xnetwork::CsrGraph, py::dict<uint32_t, int>>(
+    const xnetwork::CsrGraph&, const py::dict<uint32_t, int>&) -> VertexCoverKernel<int>;
+
+template auto vertex_cover_kernel<xnetwork::CsrGraph, std::vector<int>>(
+    const xnetwork::CsrGraph&, const std::vector<int>&) -> VertexCoverKernel<int>;
@@ -0,0 +1,73 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <future>
+#include <memory_resource>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <vector>
+#include <xnetwork/classes/arena_graph.hpp>
+#include <xnetwork/classes/graph_builder.hpp>
+#include <xnetwork/graph_algo.hpp>
+#include <xnetwork/thread_pool.hpp>
+
+TEST_CASE("Test ArenaSimpleGraph") {
+    auto gra = xnetwork::ArenaSimpleGraph{4};
+    gra.add_edge(0, 1);
+    gra.add_edge(1, 2);
+    gra.add_edge(2, 1);
+    gra.add_edge(2, 3);
+
+    CHECK_EQ(gra.number_of_nodes(), 4);
+    CHECK_EQ(gra.number_of_edges(), 3);
+    CHECK_EQ(gra.degree(1), 2);
+    CHECK(gra.has_edge(3, 2));
+    // inner sets allocate from the graph's arena
+    CHECK(gra[1].get_allocator().resource() == gra.resource());
+}
+
+TEST_CASE("Test ArenaSimpleGraph with upstream resource") {
+    std::pmr::unsynchronized_pool_resource upstream;
+    auto gra = xnetwork::ArenaSimpleGraph{3, 1024, &upstream};
+    auto builder = xnetwork::GraphBuilder<xnetwork::ArenaSimpleGraph>(3);
+    builder.add_edge(0, 1);
+    builder.add_edge(1, 2);
+    builder.build_into(gra);
+    CHECK_EQ(gra.number_of_edges(), 2);
+
+    py::dict<uint32_t, int> weight;
+    weight[0] = 1;
+    weight[1] = 1;
+    weight[2] = 1;
+    auto [coverset, cost] = min_vertex_cover_fast(gra, weight);
+    CHECK_EQ(cost, 1);
+    CHECK(coverset.contains(1));
+}
+
+TEST_CASE("Test ArenaSimpleDiGraphS") {
+    auto gra = xnetwork::ArenaSimpleDiGraphS{3};
+    gra.add_edge(0, 1, 5);
+    gra.add_edge(1, 2, -2);
+    CHECK(gra.has_successor(0, 1));
+    CHECK_FALSE(gra.has_successor(1, 0));
+    CHECK_EQ(gra[1].at(2), -2);
+    CHECK_EQ(gra.degree(0), 1);
+}
+
+TEST_CASE("Test ArenaSimpleGraph built concurrently") {
+    xnetwork::thread_pool pool(4);
+    std::vector<std::future<size_t>> futures;
+    for (uint32_t t = 0; t < 8; ++t) {
+        futures.push_back(pool.enqueue([t]() -> size_t {
+            const uint32_t num_nodes = 50 + t;
+            auto gra = xnetwork::ArenaSimpleGraph{num_nodes};
+            for (uint32_t i = 0; i + 1 < num_nodes; ++i) {
+                gra.add_edge(i, i + 1);
+            }
+            return gra.number_of_edges();
+        }));
+    }
+    for (uint32_t t = 0; t < 8; ++t) {
+        CHECK_EQ(futures[t].get(), 49 + t);
+    }
+}
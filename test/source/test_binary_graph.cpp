@@ -0,0 +1,145 @@
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <string>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/exception.hpp>
+#include <xnetwork/graph_algo.hpp>
+#include <xnetwork/readwrite/binary_graph.hpp>
+
+static auto temp_path(const char* name) -> std::string {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// overwrite `size` bytes at `pos` of an existing file
+static void patch_file(const std::string& path, std::streamoff pos, const void* data,
+                       std::streamsize size) {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(pos);
+    file.write(static_cast<const char*>(data), size);
+}
+
+static auto create_ladder() -> xnetwork::SimpleGraph {
+    xnetwork::SimpleGraph ugraph(8);
+    for (uint32_t i = 0; i < 4; ++i) {
+        ugraph.add_edge(i, i + 4);
+        if (i + 1 < 4) {
+            ugraph.add_edge(i, i + 1);
+            ugraph.add_edge(i + 4, i + 5);
+        }
+    }
+    ugraph.add_edge(2, 2);  // self loop
+    return ugraph;
+}
+
+TEST_CASE("Test binary graph round trip") {
+    const auto path = temp_path("xnetwork_test_roundtrip.xcsr");
+    const auto ugraph = create_ladder();
+    xnetwork::write_binary_graph(path, ugraph);
+
+    {
+        const auto mapped = xnetwork::open_binary_graph(path);
+        const auto& csr = mapped.graph;
+        CHECK(mapped.weights == nullptr);
+        CHECK_EQ(csr.number_of_nodes(), 8);
+        CHECK_EQ(csr.number_of_edges(), ugraph.number_of_edges());
+        CHECK(csr.edges() == xnetwork::freeze(ugraph).edges());
+        CHECK(csr.has_edge(2, 2));
+
+        py::dict<uint32_t, int> weight;
+        for (uint32_t i = 0; i < 8; ++i) {
+            weight[i] = 1;
+        }
+        auto [coverset, cost] = min_vertex_cover_fast(csr, weight);
+        csr.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+            CHECK((coverset.contains(utx) || coverset.contains(vtx)));
+        });
+        CHECK_EQ(cost, static_cast<int>(coverset.size()));
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Test binary graph weight column outlives the handle") {
+    const auto path = temp_path("xnetwork_test_weights.xcsr");
+    const auto csr = xnetwork::freeze(create_ladder());
+    std::vector<double> weights(csr.offsets()[csr.number_of_nodes()]);
+    for (size_t idx = 0; idx != weights.size(); ++idx) {
+        weights[idx] = 0.5 * static_cast<double>(idx);
+    }
+    xnetwork::write_binary_graph(path, csr, &weights);
+
+    xnetwork::CsrGraph copy;
+    const double* column = nullptr;
+    {
+        const auto mapped = xnetwork::open_binary_graph(path);
+        copy = mapped.graph;  // keeps the mapping alive
+        column = mapped.weights;
+    }
+    REQUIRE(column != nullptr);
+    CHECK_EQ(column[3], 1.5);  // exactly representable
+    CHECK_EQ(copy.number_of_edges(), csr.number_of_edges());
+    CHECK_EQ(copy.degree(0), csr.degree(0));
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Test binary graph rejects bad files") {
+    CHECK_THROWS_AS(xnetwork::open_binary_graph(temp_path("xnetwork_no_such_file.xcsr")),
+                    xnetwork::XNetworkError);
+
+    const auto path = temp_path("xnetwork_test_garbage.xcsr");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << std::string(100, 'x');
+    }
+    CHECK_THROWS_AS(xnetwork::open_binary_graph(path), xnetwork::XNetworkError);
+
+    xnetwork::write_binary_graph(path, create_ladder());
+    std::filesystem::resize_file(path, 100);  // truncate
+    CHECK_THROWS_AS(xnetwork::open_binary_graph(path), xnetwork::XNetworkError);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Test binary graph rejects corrupted headers") {
+    using Header = xnetwork::BinaryGraphHeader;
+    const auto path = temp_path("xnetwork_test_corrupt.xcsr");
+    const auto csr = xnetwork::freeze(create_ladder());
+    const std::vector<double> weights(csr.offsets()[csr.number_of_nodes()], 1.0);
+
+    const auto corrupt_field = [&](std::streamoff pos, uint64_t value) {
+        xnetwork::write_binary_graph(path, csr, &weights);
+        CHECK_NOTHROW(xnetwork::open_binary_graph(path, true));
+        patch_file(path, pos, &value, sizeof(value));
+        CHECK_THROWS_AS(xnetwork::open_binary_graph(path), xnetwork::XNetworkError);
+    };
+    corrupt_field(offsetof(Header, num_nodes), uint64_t{1} << 40);     // > uint32 ids
+    corrupt_field(offsetof(Header, num_nodes), ~uint64_t{0} / 8);      // offsets overflow
+    corrupt_field(offsetof(Header, num_arcs), ~uint64_t{0} / 4 + 1);   // neighbors overflow
+    corrupt_field(offsetof(Header, num_arcs), 10);                     // != offsets[n]
+    corrupt_field(offsetof(Header, num_edges), 1000);                  // > num_arcs
+    corrupt_field(offsetof(Header, weights_pos), 68);                  // misaligned
+    corrupt_field(offsetof(Header, weights_pos), 8);                   // overlaps the arrays
+    corrupt_field(offsetof(Header, weights_pos), ~uint64_t{7});        // past the end
+    corrupt_field(sizeof(Header), 1);                                  // offsets[0] != 0
+
+    // a non-monotone row passes the O(1) header checks but not `verify`
+    xnetwork::write_binary_graph(path, csr, &weights);
+    const uint64_t bad_offset = csr.offsets()[3] + 1;
+    patch_file(path, sizeof(Header) + 2 * sizeof(uint64_t), &bad_offset, sizeof(bad_offset));
+    CHECK_NOTHROW(xnetwork::open_binary_graph(path));
+    CHECK_THROWS_AS(xnetwork::open_binary_graph(path, true), xnetwork::XNetworkError);
+
+    xnetwork::write_binary_graph(path, csr);
+    const uint32_t bad_node = 8;
+    patch_file(path, static_cast<std::streamoff>(sizeof(Header) + 9 * sizeof(uint64_t)),
+               &bad_node, sizeof(bad_node));
+    CHECK_THROWS_AS(xnetwork::open_binary_graph(path, true), xnetwork::XNetworkError);
+    std::remove(path.c_str());
+}
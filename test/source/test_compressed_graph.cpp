@@ -0,0 +1,80 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <vector>
+#include <xnetwork/classes/compressed_graph.hpp>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/cover.hpp>
+#include <xnetwork/graph_algo.hpp>
+
+static auto create_grid(uint32_t rows, uint32_t cols) -> xnetwork::SimpleGraph {
+    xnetwork::SimpleGraph ugraph(rows * cols);
+    for (uint32_t r = 0; r < rows; ++r) {
+        for (uint32_t c = 0; c < cols; ++c) {
+            const auto node = r * cols + c;
+            if (c + 1 < cols) ugraph.add_edge(node, node + 1);
+            if (r + 1 < rows) ugraph.add_edge(node, node + cols);
+        }
+    }
+    return ugraph;
+}
+
+TEST_CASE("Test varint round trip") {
+    std::vector<uint8_t> bytes;
+    const std::vector<uint64_t> values{0, 1, 127, 128, 300, 1ULL << 35};
+    for (const auto value : values) {
+        xnetwork::detail::put_varint(bytes, value);
+    }
+    CHECK_EQ(bytes.size(), 1 + 1 + 1 + 2 + 2 + 6);
+    const uint8_t* ptr = bytes.data();
+    for (const auto value : values) {
+        CHECK_EQ(xnetwork::detail::get_varint(ptr), value);
+    }
+    CHECK_EQ(xnetwork::detail::unzigzag(xnetwork::detail::zigzag(-5)), -5);
+}
+
+TEST_CASE("Test CompressedGraph") {
+    const auto ugraph = create_grid(20, 30);
+    const auto cgraph = xnetwork::compress(ugraph);
+    const auto csr = xnetwork::freeze(ugraph);
+
+    CHECK_EQ(cgraph.number_of_nodes(), 600);
+    CHECK_EQ(cgraph.number_of_edges(), ugraph.number_of_edges());
+    for (const auto& node : cgraph) {
+        CHECK_EQ(cgraph.degree(node), ugraph.degree(node));
+        const auto row = cgraph[node];
+        CHECK(std::vector<uint32_t>(row.begin(), row.end())
+              == std::vector<uint32_t>(csr[node].begin(), csr[node].end()));
+    }
+    CHECK(cgraph.has_edge(31, 1));
+    CHECK_FALSE(cgraph.has_edge(31, 2));
+    CHECK(cgraph.edges() == csr.edges());
+
+    // small gaps fit in one byte each: less than half of the CSR neighbor array
+    CHECK_LT(2 * cgraph.compressed_bytes(), 2 * csr.number_of_edges() * sizeof(uint32_t));
+}
+
+TEST_CASE("Test algorithms on CompressedGraph") {
+    const auto cgraph = xnetwork::compress(create_grid(4, 5));
+    py::dict<uint32_t, int> weight;
+    for (uint32_t i = 0; i < 20; ++i) {
+        weight[i] = 1;
+    }
+
+    auto [coverset, cost] = min_vertex_cover_fast(cgraph, weight);
+    cgraph.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK((coverset.contains(utx) || coverset.contains(vtx)));
+    });
+    CHECK_EQ(cost, static_cast<int>(coverset.size()));
+
+    // a grid is bipartite: no odd cycle to cover
+    auto [odd_cover, odd_cost] = min_odd_cycle_cover(cgraph, weight);
+    CHECK(odd_cover.empty());
+    CHECK_EQ(odd_cost, 0);
+
+    auto [cycle_cover, cycle_cost] = min_cycle_cover(cgraph, weight);
+    CHECK_GE(cycle_cost, 1);
+}
@@ -1,12 +1,15 @@
 #include <doctest/doctest.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <optional>
 #include <py2cpp/dict.hpp>
 #include <py2cpp/set.hpp>
 #include <utility>
 #include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
 #include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/classes/node_bitset.hpp>
 #include <xnetwork/cover.hpp>
 
 TEST_CASE("Test pd_cover basic") {
@@ -208,3 +211,48 @@ TEST_CASE("Test post-processing minimality") {
         CHECK_MESSAGE(found_uncovered, "Node " << node << " was redundant in the cover");
     }
 }
+
+TEST_CASE("Test covers with vector weights and a bitset cover set") {
+    // square 0-1-2-3, triangle 4-5-6, and the chord 3-4
+    xnetwork::SimpleGraph ugraph(7);
+    ugraph.add_edge(0, 1);
+    ugraph.add_edge(1, 2);
+    ugraph.add_edge(2, 3);
+    ugraph.add_edge(3, 0);
+    ugraph.add_edge(4, 5);
+    ugraph.add_edge(5, 6);
+    ugraph.add_edge(6, 4);
+    ugraph.add_edge(3, 4);
+    py::dict<uint32_t, int> weight{{0, 2}, {1, 1}, {2, 3}, {3, 1}, {4, 2}, {5, 1}, {6, 4}};
+    auto dense_weight = xnetwork::to_dense_weights(weight, 7);
+    CHECK_EQ(dense_weight[6], 4);
+    CHECK_THROWS_AS(xnetwork::to_dense_weights(weight, 6), xnetwork::XNetworkError);
+
+    auto sorted = [](const py::set<uint32_t>& nodes) {
+        std::vector<uint32_t> result(nodes.begin(), nodes.end());
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    // the same primal-dual steps run, so the results agree with the dict/set path
+    py::set<uint32_t> soln{};
+    const auto [cover, cost] = min_vertex_cover(ugraph, weight, soln);
+    xnetwork::NodeBitset bits(7);
+    const auto [bit_cover, bit_cost] = min_vertex_cover(ugraph, dense_weight, bits);
+    CHECK_EQ(bit_cost, cost);
+    CHECK(std::vector<uint32_t>(bit_cover.begin(), bit_cover.end()) == sorted(cover));
+
+    py::set<uint32_t> odd_soln{};
+    const auto [odd_cover, odd_cost] = min_odd_cycle_cover(ugraph, weight, odd_soln);
+    xnetwork::NodeBitset odd_bits(7);
+    const auto [odd_bit_cover, odd_bit_cost]
+        = min_odd_cycle_cover(xnetwork::freeze(ugraph), dense_weight, odd_bits);
+    CHECK_EQ(odd_bit_cost, odd_cost);
+    CHECK_EQ(odd_bit_cover.size(), odd_cover.size());
+    CHECK((odd_bit_cover.contains(4) || odd_bit_cover.contains(5) || odd_bit_cover.contains(6)));
+
+    // vector weights with the default py::set result
+    const auto [set_cover, set_cost] = min_vertex_cover(ugraph, dense_weight);
+    CHECK_EQ(set_cost, cost);
+    CHECK(sorted(set_cover) == sorted(cover));
+}
@@ -0,0 +1,157 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/cover.hpp>
+#include <xnetwork/graph_algo.hpp>
+#include <xnetwork/hadlock.hpp>
+#include <xnetwork/rand_cover.hpp>
+
+static auto create_wheel() -> xnetwork::SimpleGraph {
+    // hub 0 connected to the 5-cycle 1-2-3-4-5
+    xnetwork::SimpleGraph ugraph(6);
+    for (uint32_t i = 1; i <= 5; ++i) {
+        ugraph.add_edge(0, i);
+        ugraph.add_edge(i, i % 5 + 1);
+    }
+    return ugraph;
+}
+
+TEST_CASE("Test CsrGraph freeze") {
+    const auto ugraph = create_wheel();
+    const auto csr = xnetwork::freeze(ugraph);
+
+    CHECK_EQ(csr.number_of_nodes(), 6);
+    CHECK_EQ(csr.number_of_edges(), 10);
+    CHECK_EQ(csr.degree(0), 5);
+    CHECK_EQ(csr.degree(3), 3);
+    CHECK_EQ(csr.degree_view().max_degree(), 5);
+    CHECK_EQ(csr.degree_view().nodes_by_degree().front(), 0);
+    CHECK(csr.has_edge(2, 3));
+    CHECK(csr.has_edge(3, 2));
+    CHECK_FALSE(csr.has_edge(1, 3));
+
+    // neighbor rows are sorted
+    auto prev = 0U;
+    for (const auto& nbr : csr[0]) {
+        CHECK_GT(nbr, prev);
+        prev = nbr;
+    }
+
+    auto count = 0U;
+    csr.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK_LT(utx, vtx);
+        CHECK(ugraph.has_edge(utx, vtx));
+        ++count;
+    });
+    CHECK_EQ(count, 10);
+    CHECK_EQ(csr.edges().size(), 10);
+}
+
+TEST_CASE("Test CsrGraph copies share storage") {
+    const auto csr = xnetwork::freeze(create_wheel());
+    const auto copy = csr;  // NOLINT(performance-unnecessary-copy-initialization)
+    CHECK_EQ(copy.neighbors(), csr.neighbors());
+    CHECK_EQ(copy.number_of_edges(), csr.number_of_edges());
+}
+
+TEST_CASE("Test CsrGraph upper half-adjacency") {
+    auto ugraph = create_wheel();
+    ugraph.add_edge(3, 3);  // self loop: in the full row, not in the upper half
+    const auto csr = xnetwork::freeze(ugraph);
+    REQUIRE(csr.has_upper_offsets());
+    CHECK_EQ(csr.number_of_edges(), 11);
+
+    CHECK_EQ((std::vector<uint32_t>(csr.upper(0).begin(), csr.upper(0).end())),
+             (std::vector<uint32_t>{1, 2, 3, 4, 5}));
+    CHECK_EQ((std::vector<uint32_t>(csr.upper(3).begin(), csr.upper(3).end())),
+             (std::vector<uint32_t>{4}));
+    CHECK(csr.upper(5).empty());
+    CHECK_EQ(csr[3].size(), 4);  // vertex-centric view keeps the full row
+
+    // a borrowed CSR without upper offsets finds the halves on demand
+    const xnetwork::CsrGraph borrowed{nullptr,
+                                      static_cast<uint32_t>(csr.number_of_nodes()),
+                                      csr.offsets(),
+                                      csr.neighbors(),
+                                      csr.number_of_edges()};
+    CHECK_FALSE(borrowed.has_upper_offsets());
+    for (const auto node : csr) {
+        CHECK_EQ(borrowed.upper(node).size(), csr.upper(node).size());
+    }
+    CHECK(borrowed.edges() == csr.edges());
+    CHECK_EQ(csr.edges().size(), 10);
+
+    auto count = 0U;
+    csr.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK_LT(utx, vtx);
+        ++count;
+    });
+    CHECK_EQ(count, 10);
+}
+
+TEST_CASE("Test CsrGraph freeze after remove_node") {
+    auto ugraph = create_wheel();
+    ugraph.remove_node(0);
+    ugraph.remove_node(5);
+    const auto csr = xnetwork::freeze(ugraph);
+
+    CHECK_EQ(csr.number_of_nodes(), 6);
+    CHECK_EQ(csr.number_of_edges(), 3);
+    CHECK_EQ(csr.degree(0), 0);
+    CHECK_EQ(csr.degree(5), 0);
+    CHECK_EQ(csr.degree(1), 1);
+    CHECK(csr.has_edge(3, 4));
+}
+
+TEST_CASE("Test CsrGraph empty") {
+    xnetwork::CsrGraph csr;
+    CHECK_EQ(csr.number_of_nodes(), 0);
+    CHECK_EQ(csr.number_of_edges(), 0);
+    CHECK(csr.edges().empty());
+}
+
+TEST_CASE("Test cover algorithms on CsrGraph") {
+    const auto csr = xnetwork::freeze(create_wheel());
+    py::dict<uint32_t, int> weight;
+    for (uint32_t i = 0; i < 6; ++i) {
+        weight[i] = 1;
+    }
+
+    auto [coverset, cost] = min_vertex_cover_fast(csr, weight);
+    for (const auto& [utx, vtx] : csr.edges()) {
+        CHECK((coverset.contains(utx) || coverset.contains(vtx)));
+    }
+    CHECK_EQ(cost, static_cast<int>(coverset.size()));
+
+    auto [cycle_cover, cycle_cost] = min_cycle_cover(csr, weight);
+    CHECK_GE(cycle_cost, 1);
+    CHECK_FALSE(cycle_cover.empty());
+
+    auto [rand_cover, rand_cost] = rand_vertex_cover_mt(csr, weight, 4U);
+    for (const auto& [utx, vtx] : csr.edges()) {
+        CHECK((rand_cover.contains(utx) || rand_cover.contains(vtx)));
+    }
+    CHECK_EQ(rand_cost, static_cast<int>(rand_cover.size()));
+}
+
+TEST_CASE("Test solve_hadlock_max_cut on CsrGraph") {
+    xnetwork::SimpleGraph ugraph(3);
+    ugraph.add_edge(0, 1);
+    ugraph.add_edge(1, 2);
+    ugraph.add_edge(2, 0);
+    const auto csr = xnetwork::freeze(ugraph);
+
+    auto weight = [](uint32_t, uint32_t) -> int { return 1; };
+    std::vector<std::vector<uint32_t>> faces = {{0, 1, 2}, {0, 2, 1}};
+    auto cut = solve_hadlock_max_cut(csr, weight, faces);
+    auto [ok, val] = validate_max_cut(csr, cut, weight);
+    CHECK(ok);
+    CHECK_EQ(val, 2);
+    CHECK_EQ(detail::biconnected_components(csr).size(), 1);
+}
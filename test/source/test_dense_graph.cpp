@@ -0,0 +1,89 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <vector>
+#include <xnetwork/classes/dense_graph.hpp>
+#include <xnetwork/cover.hpp>
+#include <xnetwork/exception.hpp>
+#include <xnetwork/graph_algo.hpp>
+#include <xnetwork/tsp.hpp>
+
+TEST_CASE("Test DenseGraph") {
+    xnetwork::DenseGraph gra(130);  // three words per row, last one partial
+    gra.add_edge(0, 1);
+    gra.add_edge(0, 64);
+    gra.add_edge(0, 129);
+    gra.add_edge(64, 0);  // duplicate
+    gra.add_edge(70, 71);
+
+    CHECK_EQ(gra.number_of_nodes(), 130);
+    CHECK_EQ(gra.words_per_row(), 3);
+    CHECK_EQ(gra.number_of_edges(), 4);
+    CHECK_EQ(gra.degree(0), 3);
+    CHECK(gra.has_edge(129, 0));
+    CHECK_FALSE(gra.has_edge(1, 64));
+    CHECK_EQ(std::vector<uint32_t>(gra[0].begin(), gra[0].end()),
+             (std::vector<uint32_t>{1, 64, 129}));
+    CHECK(gra[5].empty());
+
+    auto count = 0U;
+    gra.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK_LT(utx, vtx);
+        CHECK(gra.has_edge(utx, vtx));
+        ++count;
+    });
+    CHECK_EQ(count, 4);
+    CHECK_EQ(gra.edges().size(), 4);
+
+    gra.remove_edge(0, 64);
+    CHECK_EQ(gra.number_of_edges(), 3);
+    CHECK_THROWS_AS(gra.remove_edge(0, 64), xnetwork::XNetworkError);
+}
+
+TEST_CASE("Stress Test xnetwork::DenseGraph") {
+    constexpr auto num_nodes = 1000U;
+    xnetwork::DenseGraph gra(num_nodes);
+    gra.add_all_edges();
+    CHECK_EQ(gra.number_of_edges(), num_nodes * (num_nodes - 1) / 2);
+    CHECK_EQ(gra.degree(0), num_nodes - 1);
+    CHECK_EQ(gra.degree(num_nodes - 1), num_nodes - 1);
+    CHECK_FALSE(gra.has_edge(7, 7));
+    CHECK_EQ(gra.edges().size(), gra.number_of_edges());
+    const auto degrees = gra.degree_view();
+    CHECK_EQ(degrees.max_degree(), num_nodes - 1);
+
+    gra.clear();
+    CHECK_EQ(gra.number_of_edges(), 0);
+    CHECK_EQ(gra.degree(0), 0);
+    CHECK_EQ(degrees.max_degree(), 0);
+}
+
+TEST_CASE("Test algorithms on DenseGraph") {
+    xnetwork::DenseGraph gra(6);
+    gra.add_all_edges();
+    py::dict<uint32_t, int> weight;
+    for (uint32_t i = 0; i < 6; ++i) {
+        weight[i] = 1;
+    }
+
+    auto [coverset, cost] = min_vertex_cover_fast(gra, weight);
+    CHECK_EQ(cost, 5);  // a vertex cover of K6 leaves one node out
+    gra.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK((coverset.contains(utx) || coverset.contains(vtx)));
+    });
+
+    auto [indset, ind_cost] = min_maximal_independant_set(gra, weight);
+    CHECK_EQ(indset.size(), 1);
+    CHECK_EQ(ind_cost, 1);
+
+    auto [cover2, cost2] = min_vertex_cover(gra, weight);
+    CHECK_GE(cost2, 5);
+    auto [odd_cover, odd_cost] = min_odd_cycle_cover(gra, weight);
+    CHECK_GE(odd_cost, 1);
+
+    const auto tour = christofides_tsp(gra, [](uint32_t, uint32_t) { return 1.0; });
+    CHECK_EQ(tour.size(), 7);
+    CHECK_EQ(tour.front(), tour.back());
+}
@@ -0,0 +1,160 @@
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/edge_index.hpp>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/exception.hpp>
+#include <xnetwork/hadlock.hpp>
+#include <xnetwork/tsp.hpp>
+
+static auto create_kite() -> xnetwork::SimpleGraph {
+    // triangle 0-1-2, tail 2-3, self loop on 3
+    xnetwork::SimpleGraph ugraph(4);
+    ugraph.add_edge(1, 0);
+    ugraph.add_edge(0, 2);
+    ugraph.add_edge(2, 1);
+    ugraph.add_edge(3, 2);
+    ugraph.add_edge(3, 3);
+    return ugraph;
+}
+
+TEST_CASE("Test EdgeIndex assigns stable ids") {
+    const auto index = xnetwork::EdgeIndex::of(create_kite());
+    REQUIRE_EQ(index.number_of_edges(), 5);
+
+    // ids follow ascending (u, v) with u <= v
+    CHECK_EQ(index.edge_id(0, 1), 0);
+    CHECK_EQ(index.edge_id(0, 2), 1);
+    CHECK_EQ(index.edge_id(1, 2), 2);
+    CHECK_EQ(index.edge_id(2, 3), 3);
+    CHECK_EQ(index.edge_id(3, 3), 4);
+    CHECK_EQ(index.edge_id(2, 0), 1);
+    CHECK_EQ(index.source(3), 2);
+    CHECK_EQ(index.target(3), 3);
+    CHECK_THROWS_AS(index.edge_id(0, 3), xnetwork::XNetworkError);
+
+    // arc ids are aligned with the neighbor array and agree in both directions
+    const auto& gra = index.graph();
+    for (const auto utx : gra) {
+        for (auto pos = gra.offsets()[utx]; pos != gra.offsets()[utx + 1]; ++pos) {
+            const auto vtx = gra.neighbors()[pos];
+            CHECK_EQ(index.arc_edge_ids()[pos], index.edge_id(vtx, utx));
+        }
+    }
+
+    // same edge set, different insertion order -> same ids
+    xnetwork::SimpleGraph other(4);
+    other.add_edge(3, 3);
+    other.add_edge(2, 3);
+    other.add_edge(1, 2);
+    other.add_edge(0, 2);
+    other.add_edge(0, 1);
+    const auto other_index = xnetwork::EdgeIndex::of(other);
+    index.for_each_edge([&](uint32_t utx, uint32_t vtx, uint64_t eid) {
+        CHECK_EQ(other_index.edge_id(utx, vtx), eid);
+    });
+}
+
+TEST_CASE("Test EdgeWeights column") {
+    const auto index = xnetwork::EdgeIndex::of(create_kite());
+    auto weights = xnetwork::EdgeWeights<int>::from(
+        index, [](uint32_t utx, uint32_t vtx) { return static_cast<int>(10 * utx + vtx); });
+    CHECK_EQ(weights.size(), 5);
+    CHECK_EQ(weights(1, 2), 12);
+    CHECK_EQ(weights(2, 1), 12);
+    weights[index.edge_id(2, 3)] = 7;
+    CHECK_EQ(weights(3, 2), 7);
+
+    const auto& gra = index.graph();
+    for (const auto utx : gra) {
+        for (auto pos = gra.offsets()[utx]; pos != gra.offsets()[utx + 1]; ++pos) {
+            CHECK_EQ(weights.at_arc(pos), weights(utx, gra.neighbors()[pos]));
+        }
+    }
+
+    const xnetwork::EdgeWeights<double> zeros(index);
+    CHECK_EQ(zeros(0, 1), 0.0);
+
+    // the column keeps its own (shared) copy of a temporary index
+    const xnetwork::EdgeWeights<int> ones(xnetwork::EdgeIndex::of(create_kite()), 1);
+    CHECK_EQ(ones(3, 2), 1);
+    CHECK_EQ(ones.at_arc(0), 1);
+    CHECK_EQ(ones.index().number_of_edges(), 5);
+}
+
+TEST_CASE("Test EdgeWeights as an algorithm weight function") {
+    // the Hadlock triangle test, with weights in a column instead of an if-chain
+    xnetwork::SimpleGraph triangle(3);
+    triangle.add_edge(0, 1);
+    triangle.add_edge(1, 2);
+    triangle.add_edge(2, 0);
+    const auto index = xnetwork::EdgeIndex::of(triangle);
+    xnetwork::EdgeWeights<int> weight(index);
+    weight[index.edge_id(0, 1)] = 5;
+    weight[index.edge_id(1, 2)] = 10;
+    weight[index.edge_id(2, 0)] = 3;
+
+    const std::vector<std::vector<uint32_t>> faces = {{0, 1, 2}, {0, 2, 1}};
+    const auto cut = solve_hadlock_max_cut(index.graph(), weight, faces);
+    const auto [ok, val] = validate_max_cut(index.graph(), cut, weight);
+    CHECK(ok);
+    CHECK_EQ(val, 15);
+}
+
+TEST_CASE("Test Hadlock on an edge-id column matches the callable") {
+    // two triangles sharing vertex 2 (a bowtie) plus a square 4-5-6-7 hanging off 3
+    xnetwork::SimpleGraph gra(8);
+    const std::vector<std::pair<uint32_t, uint32_t>> edges{
+        {0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 2}, {4, 5}, {5, 6}, {6, 7}, {7, 4}};
+    gra.add_edges_from(edges);
+    auto func = [](uint32_t utx, uint32_t vtx) {
+        return static_cast<int>((utx * 7 + vtx * 7) % 5 + 1);
+    };
+    const auto weight = xnetwork::EdgeWeights<int>::from(xnetwork::EdgeIndex::of(gra), func);
+
+    const std::vector<std::vector<uint32_t>> faces
+        = {{0, 1, 2}, {2, 3, 4}, {4, 5, 6, 7}, {0, 2, 4, 7, 6, 5, 4, 3, 2, 1}};
+    const auto cut = solve_hadlock_max_cut(weight.index().graph(), weight, faces);
+    CHECK(cut == solve_hadlock_max_cut(weight.index().graph(), func, faces));
+    CHECK_EQ(validate_max_cut(gra, cut, weight), validate_max_cut(gra, cut, func));
+
+    const std::vector<std::vector<std::vector<uint32_t>>> component_faces
+        = {{{0, 1, 2}, {0, 2, 1}}, {{2, 3, 4}, {2, 4, 3}}, {{4, 5, 6, 7}, {4, 7, 6, 5}}};
+    const auto block_cut = solve_hadlock_max_cut(weight.index().graph(), weight, component_faces);
+    CHECK(block_cut == solve_hadlock_max_cut(weight.index().graph(), func, component_faces));
+    CHECK(validate_max_cut(gra, block_cut, weight).first);
+}
+
+TEST_CASE("Test TSP solver tabulates the weight callable once") {
+    const xnetwork::SimpleGraph gra(12);
+    size_t calls = 0;
+    auto dist = [&calls](uint32_t utx, uint32_t vtx) {
+        ++calls;
+        CHECK_NE(utx, vtx);  // the diagonal is never queried
+        return static_cast<double>(utx > vtx ? utx - vtx : vtx - utx);
+    };
+    const auto tour = solve_christofides_2opt_tsp(gra, dist);
+    CHECK_EQ(calls, 12 * 11);  // every later lookup is a load from the WeightMatrix
+    CHECK_EQ(tour.size(), 13);
+    CHECK_EQ(calculate_total_distance(tour, dist), 22.0);
+}
+
+TEST_CASE("Test WeightMatrix with TSP") {
+    // 6 points on a line: |i - j| is metric
+    const xnetwork::SimpleGraph gra(6);
+    auto dist = [](uint32_t utx, uint32_t vtx) {
+        return static_cast<double>(utx > vtx ? utx - vtx : vtx - utx);
+    };
+    const WeightMatrix<double> table(gra.number_of_nodes(), dist);
+    CHECK_EQ(table.size(), 6);
+    CHECK_EQ(table(1U, 4U), 3.0);
+
+    const auto tour = solve_christofides_2opt_tsp(gra, table);
+    CHECK_EQ(tour.size(), 7);
+    CHECK_EQ(calculate_total_distance(tour, table), calculate_total_distance(tour, dist));
+    CHECK_EQ(calculate_total_distance(tour, table), 10.0);
+}
@@ -0,0 +1,164 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/exception.hpp>
+#include <xnetwork/readwrite/edgelist.hpp>
+#include <xnetwork/thread_pool.hpp>
+
+using edge_t = xnetwork::EdgeChunks::edge_t;
+
+static auto flatten(const xnetwork::EdgeChunks& parsed) -> std::vector<edge_t> {
+    std::vector<edge_t> edges;
+    for (const auto& chunk : parsed.chunks) {
+        edges.insert(edges.end(), chunk.begin(), chunk.end());
+    }
+    return edges;
+}
+
+TEST_CASE("Test parse SNAP edge list") {
+    xnetwork::thread_pool pool(2);
+    const auto parsed = xnetwork::parse_edge_list(
+        "# Directed graph\n# FromNodeId\tToNodeId\n0\t1\n1\t2\r\n\n% other comment\n5 0 7\n",
+        xnetwork::EdgeListFormat::snap, pool);
+    CHECK_EQ(parsed.num_nodes, 6);
+    CHECK_EQ(parsed.num_edges(), 3);
+    CHECK(flatten(parsed) == (std::vector<edge_t>{{0, 1}, {1, 2}, {5, 0}}));
+
+    CHECK_THROWS_AS(xnetwork::parse_edge_list("0 1\n2\n", xnetwork::EdgeListFormat::snap, pool),
+                    xnetwork::XNetworkError);
+    CHECK_THROWS_AS(xnetwork::parse_edge_list("0 x\n", xnetwork::EdgeListFormat::snap, pool),
+                    xnetwork::XNetworkError);
+}
+
+TEST_CASE("Test parse METIS graph") {
+    xnetwork::thread_pool pool(2);
+    // triangle 1-2-3 plus an isolated node 4
+    const auto parsed = xnetwork::parse_edge_list("% comment\n4 3\n2 3\n1 3\n1 2\n\n",
+                                                  xnetwork::EdgeListFormat::metis, pool);
+    CHECK_EQ(parsed.num_nodes, 4);
+    CHECK(flatten(parsed) == (std::vector<edge_t>{{0, 1}, {0, 2}, {1, 0}, {1, 2}, {2, 0}, {2, 1}}));
+
+    // fmt 011: one vertex weight, then (neighbor, edge weight) pairs
+    const auto weighted = xnetwork::parse_edge_list("3 2 011\n5 2 7\n6 1 7 3 9\n4 2 9\n",
+                                                    xnetwork::EdgeListFormat::metis, pool);
+    CHECK(flatten(weighted) == (std::vector<edge_t>{{0, 1}, {1, 0}, {1, 2}, {2, 1}}));
+
+    CHECK_THROWS_AS(xnetwork::parse_edge_list("2 1\n3\n1\n", xnetwork::EdgeListFormat::metis, pool),
+                    xnetwork::XNetworkError);
+    CHECK_THROWS_AS(xnetwork::parse_edge_list("% only\n", xnetwork::EdgeListFormat::metis, pool),
+                    xnetwork::XNetworkError);
+}
+
+TEST_CASE("Test parse DIMACS and PACE graphs") {
+    xnetwork::thread_pool pool(2);
+    const auto dimacs = xnetwork::parse_edge_list("c comment\np edge 3 2\ne 1 2\ne 2 3\n",
+                                                  xnetwork::EdgeListFormat::dimacs, pool);
+    CHECK_EQ(dimacs.num_nodes, 3);
+    CHECK(flatten(dimacs) == (std::vector<edge_t>{{0, 1}, {1, 2}}));
+
+    const auto pace = xnetwork::parse_edge_list("p td 4 2\n1 4\nc note\n3 2\n",
+                                                xnetwork::EdgeListFormat::dimacs, pool);
+    CHECK_EQ(pace.num_nodes, 4);
+    CHECK(flatten(pace) == (std::vector<edge_t>{{0, 3}, {2, 1}}));
+
+    CHECK_THROWS_AS(xnetwork::parse_edge_list("p td 2 1\n1 3\n", xnetwork::EdgeListFormat::dimacs,
+                                              pool),
+                    xnetwork::XNetworkError);
+}
+
+TEST_CASE("Test parse edge list in many chunks") {
+    xnetwork::thread_pool pool(4);
+    const uint32_t num_nodes = 500;
+    std::string snap;
+    std::string metis = "% ring\n" + std::to_string(num_nodes) + " "
+                        + std::to_string(num_nodes) + "\n";
+    for (uint32_t i = 0; i < num_nodes; ++i) {
+        const auto next = (i + 1) % num_nodes;
+        const auto prev = (i + num_nodes - 1) % num_nodes;
+        snap += std::to_string(i) + " " + std::to_string(next) + "\n";
+        metis += std::to_string(prev + 1) + " " + std::to_string(next + 1) + "\n";
+    }
+
+    // a tiny minimum chunk size forces one task per pool slot
+    const auto parsed_snap
+        = xnetwork::parse_edge_list(snap, xnetwork::EdgeListFormat::snap, pool, 16);
+    CHECK(parsed_snap.chunks.size() > 1);
+    CHECK_EQ(parsed_snap.num_nodes, num_nodes);
+    const auto snap_edges = flatten(parsed_snap);
+    REQUIRE_EQ(snap_edges.size(), num_nodes);
+    for (uint32_t i = 0; i < num_nodes; ++i) {
+        CHECK(snap_edges[i] == edge_t{i, (i + 1) % num_nodes});
+    }
+
+    const auto parsed_metis
+        = xnetwork::parse_edge_list(metis, xnetwork::EdgeListFormat::metis, pool, 16);
+    CHECK(parsed_metis.chunks.size() > 1);
+    const auto metis_edges = flatten(parsed_metis);
+    REQUIRE_EQ(metis_edges.size(), 2 * num_nodes);
+    for (uint32_t i = 0; i < num_nodes; ++i) {
+        CHECK_EQ(metis_edges[2 * i].first, i);
+        CHECK_EQ(metis_edges[2 * i + 1].second, (i + 1) % num_nodes);
+    }
+}
+
+TEST_CASE("Test parse malformed edge list in many chunks") {
+    xnetwork::thread_pool pool(4);
+    const uint32_t num_nodes = 500;
+    std::string snap = "0 x\n";  // malformed first chunk; later chunks still parse
+    std::string metis = "% ring\n" + std::to_string(num_nodes) + " "
+                        + std::to_string(num_nodes) + "\n0\n";
+    std::string dimacs = "p td " + std::to_string(num_nodes) + " " + std::to_string(num_nodes)
+                         + "\n1 0\n";
+    for (uint32_t i = 1; i < num_nodes; ++i) {
+        const auto next = (i + 1) % num_nodes;
+        snap += std::to_string(i) + " " + std::to_string(next) + "\n";
+        metis += std::to_string(i) + " " + std::to_string(next + 1) + "\n";
+        dimacs += std::to_string(i + 1) + " " + std::to_string(next + 1) + "\n";
+    }
+
+    // the text dies as soon as the error leaves parse_edge_list(), so every
+    // chunk task must have finished by then
+    const auto parse_copy = [&pool](const std::string& text, xnetwork::EdgeListFormat format) {
+        const std::string copy = text;
+        return xnetwork::parse_edge_list(copy, format, pool, 16);
+    };
+    CHECK_THROWS_AS(parse_copy(snap, xnetwork::EdgeListFormat::snap), xnetwork::XNetworkError);
+    CHECK_THROWS_AS(parse_copy(metis, xnetwork::EdgeListFormat::metis), xnetwork::XNetworkError);
+    CHECK_THROWS_AS(parse_copy(dimacs, xnetwork::EdgeListFormat::dimacs),
+                    xnetwork::XNetworkError);
+
+    // the pool is still usable afterwards
+    CHECK_EQ(parse_copy("0 1\n", xnetwork::EdgeListFormat::snap).num_nodes, 2);
+}
+
+TEST_CASE("Test read_graph from file") {
+    const auto path
+        = (std::filesystem::temp_directory_path() / "xnetwork_test_edgelist.txt").string();
+    {
+        std::ofstream out(path);
+        out << "# 4-cycle with a duplicate and a reversed edge\n"
+            << "0 1\n1 2\n2 3\n3 0\n1 0\n0 1\n";
+    }
+
+    xnetwork::thread_pool pool(2);
+    const auto ugraph = xnetwork::read_graph(path, xnetwork::EdgeListFormat::snap, pool);
+    CHECK_EQ(ugraph.number_of_nodes(), 4);
+    CHECK_EQ(ugraph.number_of_edges(), 4);
+    CHECK(ugraph.has_edge(3, 0));
+
+    const auto csr = xnetwork::read_graph<xnetwork::CsrGraph>(path, xnetwork::EdgeListFormat::snap);
+    CHECK_EQ(csr.number_of_edges(), 4);
+    CHECK_EQ(csr.degree(0), 2);
+
+    std::remove(path.c_str());
+    CHECK_THROWS_AS(xnetwork::read_graph(path, xnetwork::EdgeListFormat::snap, pool),
+                    xnetwork::XNetworkError);
+}
@@ -0,0 +1,94 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <xnetwork/classes/compressed_graph.hpp>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/edge_index.hpp>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/fingerprint.hpp>
+#include <xnetwork/thread_pool.hpp>
+
+static auto create_ring(uint32_t num_nodes, bool reversed) -> xnetwork::SimpleGraph {
+    xnetwork::SimpleGraph ugraph(num_nodes);
+    for (uint32_t idx = 0; idx != num_nodes; ++idx) {
+        const auto node = reversed ? num_nodes - 1 - idx : idx;
+        ugraph.add_edge((node + 1) % num_nodes, node);
+    }
+    return ugraph;
+}
+
+TEST_CASE("Test fingerprint is order- and class-independent") {
+    const auto ring = create_ring(100, false);
+    const auto fp = xnetwork::fingerprint(ring);
+    CHECK(fp == xnetwork::fingerprint(create_ring(100, true)));
+    CHECK(fp == xnetwork::fingerprint(xnetwork::freeze(ring)));
+    CHECK(fp == xnetwork::fingerprint(xnetwork::compress(ring)));
+
+    // structure changes are detected
+    auto chord = create_ring(100, false);
+    chord.add_edge(0, 50);
+    CHECK(fp != xnetwork::fingerprint(chord));
+    CHECK(fp != xnetwork::fingerprint(create_ring(101, false)));
+    CHECK(xnetwork::fingerprint(xnetwork::SimpleGraph(3))
+          != xnetwork::fingerprint(xnetwork::SimpleGraph(4)));
+
+    // the same edge {0, 1} at a different place is a different graph
+    xnetwork::SimpleGraph first(3);
+    first.add_edge(0, 1);
+    xnetwork::SimpleGraph second(3);
+    second.add_edge(1, 2);
+    CHECK(xnetwork::fingerprint(first) != xnetwork::fingerprint(second));
+}
+
+TEST_CASE("Test parallel fingerprint matches the serial one") {
+    const auto ring = create_ring(1000, false);
+    xnetwork::thread_pool pool(4);
+    CHECK(xnetwork::fingerprint(ring, pool) == xnetwork::fingerprint(ring));
+
+    py::dict<uint32_t, int> weight;
+    for (uint32_t node = 0; node != 1000; ++node) {
+        weight[node] = static_cast<int>(node % 7);
+    }
+    CHECK(xnetwork::fingerprint(ring, pool, weight) == xnetwork::fingerprint(ring, weight));
+
+    // a missing weight throws only after every task has stopped reading the
+    // temporary map, so the map may be destroyed while the error unwinds
+    const auto partial = [&weight]() {
+        auto missing = weight;
+        missing.erase(3U);
+        return missing;
+    };
+    CHECK_THROWS_AS(xnetwork::fingerprint(ring, pool, partial()), std::out_of_range);
+}
+
+TEST_CASE("Test fingerprint with weights") {
+    const auto ring = create_ring(10, false);
+    const auto plain = xnetwork::fingerprint(ring);
+
+    std::vector<double> node_weight(10, 1.0);
+    const auto weighted = xnetwork::fingerprint(ring, node_weight);
+    CHECK(weighted != plain);
+    node_weight[3] = 2.0;
+    CHECK(xnetwork::fingerprint(ring, node_weight) != weighted);
+
+    const auto index = xnetwork::EdgeIndex::of(ring);
+    auto edge_weight = xnetwork::EdgeWeights<int>(index, 1);
+    const auto by_edge = xnetwork::fingerprint(ring, edge_weight);
+    CHECK(by_edge != plain);
+    CHECK(by_edge == xnetwork::fingerprint(index.graph(), edge_weight));
+    edge_weight[index.edge_id(4, 5)] = 9;
+    CHECK(xnetwork::fingerprint(ring, edge_weight) != by_edge);
+    CHECK(xnetwork::fingerprint(ring, [](uint32_t, uint32_t) { return 1; }) != plain);
+}
+
+TEST_CASE("Test fingerprint as a cache key") {
+    std::unordered_map<xnetwork::Fingerprint, std::string> cache;
+    cache[xnetwork::fingerprint(create_ring(8, false))] = "ring";
+    CHECK_EQ(cache.count(xnetwork::fingerprint(create_ring(8, true))), 1);
+    CHECK_EQ(cache.count(xnetwork::fingerprint(create_ring(9, true))), 0);
+}
@@ -0,0 +1,80 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/flat_set.hpp>
+#include <xnetwork/classes/graph_builder.hpp>
+#include <xnetwork/graph_algo.hpp>
+
+TEST_CASE("Test flat_set") {
+    xnetwork::flat_set<uint32_t> nbrs{7, 3, 5, 3};
+    CHECK_EQ(nbrs.size(), 3);
+    CHECK(nbrs.insert(9).second);   // append fast path
+    CHECK(nbrs.insert(4).second);   // middle insert
+    CHECK_FALSE(nbrs.insert(5).second);
+    CHECK_EQ(std::vector<uint32_t>(nbrs.begin(), nbrs.end()),
+             (std::vector<uint32_t>{3, 4, 5, 7, 9}));
+    CHECK(nbrs.contains(7));
+    CHECK_FALSE(nbrs.contains(6));
+    CHECK_EQ(nbrs.erase(4), 1);
+    CHECK_EQ(nbrs.erase(4), 0);
+    CHECK(nbrs.find(4) == nbrs.end());
+
+    std::vector<uint32_t> more{8, 1, 9};
+    nbrs.insert(more.begin(), more.end());
+    CHECK_EQ(std::vector<uint32_t>(nbrs.begin(), nbrs.end()),
+             (std::vector<uint32_t>{1, 3, 5, 7, 8, 9}));
+
+    // large sets switch from linear scan to binary search
+    xnetwork::flat_set<uint32_t> big;
+    for (uint32_t i = 0; i < 100; i += 2) {
+        big.insert(i);
+    }
+    CHECK(big.contains(42));
+    CHECK_FALSE(big.contains(43));
+    CHECK_EQ(xnetwork::intersection_size(nbrs, big), 1);  // {8}
+}
+
+TEST_CASE("Test FlatSimpleGraph") {
+    auto builder = xnetwork::GraphBuilder<xnetwork::FlatSimpleGraph>(5);
+    builder.add_edge(0, 1);
+    builder.add_edge(1, 2);
+    builder.add_edge(2, 0);
+    builder.add_edge(2, 3);
+    builder.add_edge(3, 4);
+    builder.add_edge(4, 2);
+    builder.add_edge(1, 0);
+    auto gra = builder.build();
+    CHECK_EQ(gra.number_of_edges(), 6);
+    CHECK(gra.has_edge(4, 3));
+
+    // triangle count via sorted-neighbor intersection
+    size_t triangles = 0;
+    gra.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        xnetwork::for_each_common(gra[utx], gra[vtx], [&](uint32_t wtx) {
+            if (vtx < wtx) ++triangles;
+        });
+    });
+    CHECK_EQ(triangles, 2);
+
+    // a CSR snapshot row and a flat_set row can be intersected directly
+    CHECK_EQ(xnetwork::intersection_size(xnetwork::freeze(gra)[2], gra[2]), 4);
+
+    gra.remove_node(2);
+    CHECK_EQ(gra.number_of_edges(), 2);
+    gra.compact();
+    CHECK(gra.has_edge(2, 3));  // old (3, 4)
+
+    py::dict<uint32_t, int> weight;
+    for (uint32_t i = 0; i < 4; ++i) {
+        weight[i] = 1;
+    }
+    auto [coverset, cost] = min_vertex_cover_fast(gra, weight);
+    gra.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK((coverset.contains(utx) || coverset.contains(vtx)));
+    });
+    CHECK_EQ(cost, static_cast<int>(coverset.size()));
+}
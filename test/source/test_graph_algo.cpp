@@ -1,11 +1,16 @@
 #include <doctest/doctest.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <py2cpp/dict.hpp>
 #include <py2cpp/set.hpp>
 #include <utility>                     // for std::pair
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
 #include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/classes/node_bitset.hpp>
 #include <xnetwork/graph_algo.hpp>
+#include <xnetwork/thread_pool.hpp>
 
 TEST_CASE("Test min_vertex_cover_fast - Basic Example 1") {
     // Create graph: 0-1-2 with all weights 1
@@ -245,3 +250,204 @@ TEST_CASE("Test Single Vertex Graph") {
     CHECK_EQ(ind_weight, 5);
     CHECK(ind_set.contains(0));
 }
+
+TEST_CASE("Test min_vertex_cover_fast_par") {
+    // 20 x 20 grid with a few heavy nodes
+    const uint32_t side = 20;
+    xnetwork::SimpleGraph ugraph(side * side);
+    for (uint32_t row = 0; row < side; ++row) {
+        for (uint32_t col = 0; col < side; ++col) {
+            const auto node = row * side + col;
+            if (col + 1 < side) ugraph.add_edge(node, node + 1);
+            if (row + 1 < side) ugraph.add_edge(node, node + side);
+        }
+    }
+    py::dict<uint32_t, int> weight;
+    for (uint32_t node = 0; node != side * side; ++node) {
+        weight[node] = 1 + static_cast<int>(node % 5);
+    }
+
+    xnetwork::thread_pool pool(4);
+    const auto csr = xnetwork::freeze(ugraph);
+    for (int run = 0; run != 3; ++run) {
+        const auto [coverset, total_weight]
+            = run == 0 ? min_vertex_cover_fast_par(ugraph, weight, pool)
+                       : min_vertex_cover_fast_par(csr, weight, pool);
+        ugraph.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+            CHECK((coverset.contains(utx) || coverset.contains(vtx)));
+        });
+        int cost = 0;
+        for (const auto node : coverset) cost += weight[node];
+        CHECK_EQ(cost, total_weight);
+    }
+
+    // a light hub is the only sensible cover of a star, in any edge order
+    xnetwork::SimpleGraph star(9);
+    for (uint32_t leaf = 1; leaf != 9; ++leaf) star.add_edge(0, leaf);
+    py::dict<uint32_t, int> star_weight{{0, 1}};
+    for (uint32_t leaf = 1; leaf != 9; ++leaf) star_weight[leaf] = 5;
+    const auto [star_cover, star_cost] = min_vertex_cover_fast_par(star, star_weight, 2);
+    CHECK_EQ(star_cost, 1);
+    CHECK_EQ(star_cover.size(), 1);
+    CHECK(star_cover.contains(0));
+}
+
+TEST_CASE("Test min_maximal_independant_set_par") {
+    // 30 x 30 grid
+    const uint32_t side = 30;
+    xnetwork::SimpleGraph ugraph(side * side);
+    for (uint32_t row = 0; row < side; ++row) {
+        for (uint32_t col = 0; col < side; ++col) {
+            const auto node = row * side + col;
+            if (col + 1 < side) ugraph.add_edge(node, node + 1);
+            if (row + 1 < side) ugraph.add_edge(node, node + side);
+        }
+    }
+    py::dict<uint32_t, int> weight;
+    for (uint32_t node = 0; node != side * side; ++node) {
+        weight[node] = 1 + static_cast<int>(node * 7 % 4);
+    }
+
+    xnetwork::thread_pool pool(4);
+    const auto [indset, total_weight] = min_maximal_independant_set_par(ugraph, weight, pool);
+    int cost = 0;
+    for (const auto node : indset) cost += weight[node];
+    CHECK_EQ(cost, total_weight);
+    for (uint32_t node = 0; node != side * side; ++node) {
+        bool has_nbr_in_set = false;
+        for (const auto nbr : ugraph[node]) {
+            has_nbr_in_set = has_nbr_in_set || indset.contains(nbr);
+        }
+        if (indset.contains(node)) {
+            CHECK_FALSE(has_nbr_in_set);  // independent
+        } else {
+            CHECK(has_nbr_in_set);  // maximal
+        }
+    }
+
+    // deterministic: independent of the graph class and the number of threads
+    const auto [csr_set, csr_weight] = min_maximal_independant_set_par(
+        xnetwork::freeze(ugraph), weight, 1);
+    CHECK_EQ(csr_weight, total_weight);
+    CHECK(csr_set == indset);
+
+    // lightest first: the leaves go in before the heavier hub
+    xnetwork::SimpleGraph star(6);
+    for (uint32_t leaf = 1; leaf != 6; ++leaf) star.add_edge(0, leaf);
+    py::dict<uint32_t, int> star_weight{{0, 3}};
+    for (uint32_t leaf = 1; leaf != 6; ++leaf) star_weight[leaf] = 1;
+    const auto [star_set, star_cost] = min_maximal_independant_set_par(star, star_weight, pool);
+    CHECK_EQ(star_cost, 5);
+    CHECK_FALSE(star_set.contains(0));
+}
+
+TEST_CASE("Test min_maximal_independant_set_par on a monotone-weight path") {
+    // weights fall as the id rises: strict weight-first priorities would decide
+    // only O(1) nodes per round here, while weight classes keep the rounds few
+    const uint32_t num_nodes = 50000;
+    xnetwork::SimpleGraph path(num_nodes);
+    std::vector<int> weight(num_nodes);
+    for (uint32_t node = 0; node != num_nodes; ++node) {
+        weight[node] = static_cast<int>(num_nodes - node);
+        if (node + 1 != num_nodes) path.add_edge(node, node + 1);
+    }
+
+    xnetwork::thread_pool pool(4);
+    const auto [indset, total_weight] = min_maximal_independant_set_par(path, weight, pool);
+    int64_t cost = 0;
+    for (uint32_t node = 0; node != num_nodes; ++node) {
+        const bool left = node > 0 && indset.contains(node - 1);
+        const bool right = node + 1 != num_nodes && indset.contains(node + 1);
+        if (indset.contains(node)) {
+            cost += weight[node];
+            CHECK_FALSE((left || right));  // independent
+        } else {
+            CHECK((left || right));  // maximal
+        }
+    }
+    CHECK_EQ(cost, total_weight);
+    CHECK(min_maximal_independant_set_par(path, weight, 1).first == indset);
+}
+
+TEST_CASE("Test vector weights and bitset sets") {
+    // 8-cycle with the chords 0-4 and 2-6
+    xnetwork::SimpleGraph ugraph(8);
+    for (uint32_t node = 0; node != 8; ++node) ugraph.add_edge(node, (node + 1) % 8);
+    ugraph.add_edge(0, 4);
+    ugraph.add_edge(2, 6);
+    py::dict<uint32_t, int> weight;
+    std::vector<int> dense_weight(8);
+    for (uint32_t node = 0; node != 8; ++node) {
+        weight[node] = 1 + static_cast<int>(node * 5 % 3);
+        dense_weight[node] = weight[node];
+    }
+    auto sorted = [](const py::set<uint32_t>& nodes) {
+        std::vector<uint32_t> result(nodes.begin(), nodes.end());
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    const auto [cover, cost] = min_vertex_cover_fast(ugraph, weight);
+    xnetwork::NodeBitset coverset(8);
+    const auto [bit_cover, bit_cost] = min_vertex_cover_fast(ugraph, dense_weight, coverset);
+    CHECK_EQ(bit_cost, cost);
+    CHECK(std::vector<uint32_t>(bit_cover.begin(), bit_cover.end()) == sorted(cover));
+    ugraph.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK((bit_cover.contains(utx) || bit_cover.contains(vtx)));
+    });
+
+    const auto [indset, ind_cost] = min_maximal_independant_set(ugraph, weight);
+    xnetwork::NodeBitset bit_indset(8);
+    xnetwork::NodeBitset dep(8);
+    const auto [bit_ind, bit_ind_cost]
+        = min_maximal_independant_set(xnetwork::freeze(ugraph), dense_weight, bit_indset, dep);
+    CHECK_EQ(bit_ind_cost, ind_cost);
+    CHECK(std::vector<uint32_t>(bit_ind.begin(), bit_ind.end()) == sorted(indset));
+
+    // the parallel versions read vector weights as well
+    const auto [par_set, par_cost] = min_maximal_independant_set_par(ugraph, dense_weight, 2);
+    const auto [par_dict_set, par_dict_cost] = min_maximal_independant_set_par(ugraph, weight, 2);
+    CHECK_EQ(par_cost, par_dict_cost);
+    CHECK(par_set == par_dict_set);
+    const auto [par_cover, par_cover_cost] = min_vertex_cover_fast_par(ugraph, dense_weight, 2);
+    int recount = 0;
+    for (const auto node : par_cover) recount += dense_weight[node];
+    CHECK_EQ(recount, par_cover_cost);
+}
+
+TEST_CASE("Test min_vertex_cover_fast_batch") {
+    // 6 x 6 grid with one diagonal per cell
+    const uint32_t side = 6;
+    xnetwork::SimpleGraph ugraph(side * side);
+    for (uint32_t row = 0; row < side; ++row) {
+        for (uint32_t col = 0; col < side; ++col) {
+            const auto node = row * side + col;
+            if (col + 1 < side) ugraph.add_edge(node, node + 1);
+            if (row + 1 < side) ugraph.add_edge(node, node + side);
+            if (col + 1 < side && row + 1 < side) ugraph.add_edge(node, node + side + 1);
+        }
+    }
+    std::vector<std::vector<int>> weights(5, std::vector<int>(side * side));
+    for (uint32_t lane = 0; lane != 5; ++lane) {
+        for (uint32_t node = 0; node != side * side; ++node) {
+            weights[lane][node] = 1 + static_cast<int>((node * (lane + 3) + lane) % 7);
+        }
+    }
+
+    // every lane equals its own sequential run, on either graph class
+    const auto batch = min_vertex_cover_fast_batch(ugraph, weights);
+    const auto csr_batch = min_vertex_cover_fast_batch(xnetwork::freeze(ugraph), weights);
+    REQUIRE_EQ(batch.size(), 5);
+    REQUIRE_EQ(csr_batch.size(), 5);
+    for (uint32_t lane = 0; lane != 5; ++lane) {
+        xnetwork::NodeBitset coverset(side * side);
+        const auto [cover, cost] = min_vertex_cover_fast(ugraph, weights[lane], coverset);
+        CHECK_EQ(batch[lane].second, cost);
+        CHECK(batch[lane].first == cover);
+        ugraph.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+            CHECK((csr_batch[lane].first.contains(utx) || csr_batch[lane].first.contains(vtx)));
+        });
+    }
+
+    CHECK(min_vertex_cover_fast_batch(ugraph, std::vector<std::vector<int>>{}).empty());
+}
@@ -0,0 +1,154 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <future>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/classes/graph_builder.hpp>
+#include <xnetwork/thread_pool.hpp>
+
+TEST_CASE("Test GraphBuilder dedupes edges") {
+    using Edge = std::pair<uint32_t, uint32_t>;
+    std::vector<Edge> edges{{0, 1}, {1, 0}, {1, 2}, {0, 1}, {2, 3}, {3, 3}, {3, 2}};
+
+    auto builder = xnetwork::GraphBuilder<>(4);
+    builder.add_edges_from(edges);
+    const auto gra = builder.build();
+
+    CHECK_EQ(gra.number_of_nodes(), 4);
+    CHECK_EQ(gra.number_of_edges(), 4);  // {0,1}, {1,2}, {2,3} and the self loop {3,3}
+    CHECK_EQ(gra.degree(0), 1);
+    CHECK_EQ(gra.degree(1), 2);
+    CHECK(gra.has_edge(2, 1));
+    CHECK(gra.has_edge(3, 3));
+    CHECK_EQ(gra.edges().size(), 3);
+}
+
+TEST_CASE("Test GraphBuilder build_csr") {
+    // Large enough to take the radix-sort path
+    constexpr uint32_t num_nodes = 1000;
+    auto builder = xnetwork::GraphBuilder<>(num_nodes);
+    auto reference = xnetwork::SimpleGraph(num_nodes);
+    for (uint32_t i = 0; i < num_nodes; ++i) {
+        for (uint32_t j : {(i * 7 + 3) % num_nodes, (i * 13 + 5) % num_nodes}) {
+            if (i == j) continue;
+            builder.add_edge(i, j);
+            builder.add_edge(j, i);
+            reference.add_edge(i, j);
+        }
+    }
+    const auto csr = builder.build_csr();
+
+    CHECK_EQ(csr.number_of_nodes(), num_nodes);
+    CHECK_EQ(csr.number_of_edges(), reference.number_of_edges());
+    for (uint32_t i = 0; i < num_nodes; ++i) {
+        CHECK_EQ(csr.degree(i), reference.degree(i));
+        const auto nbrs = csr[i];
+        for (size_t k = 1; k < nbrs.size(); ++k) {
+            CHECK_LT(nbrs[k - 1], nbrs[k]);
+        }
+    }
+    csr.for_each_edge([&](uint32_t utx, uint32_t vtx) { CHECK(reference.has_edge(utx, vtx)); });
+}
+
+TEST_CASE("Test GraphBuilder<CsrGraph> and build_into") {
+    auto builder = xnetwork::GraphBuilder<xnetwork::CsrGraph>(3);
+    builder.add_edge(0, 1);
+    builder.add_edge(1, 2);
+    const auto csr = builder.build();
+    CHECK_EQ(csr.number_of_edges(), 2);
+
+    auto gra = xnetwork::SimpleGraph(3);
+    gra.add_edge(0, 1);
+    auto builder2 = xnetwork::GraphBuilder<>(3);
+    builder2.add_edge(1, 0);
+    builder2.add_edge(2, 1);
+    builder2.build_into(gra);
+    CHECK_EQ(gra.number_of_edges(), 2);
+    CHECK(gra.has_edge(1, 2));
+}
+
+TEST_CASE("Test GraphBuilder build_into keeps views and tombstones in sync") {
+    auto gra = xnetwork::SimpleGraph(4);
+    gra.add_edge(2, 3);
+    gra.remove_node(3);
+    const auto degrees = gra.degree_view();
+    CHECK_EQ(degrees[0], 0);
+
+    auto builder = xnetwork::GraphBuilder<>(4);
+    builder.add_edge(0, 1);
+    builder.add_edge(0, 3);
+    builder.build_into(gra);
+    CHECK(degrees.is_stale());
+    CHECK_EQ(degrees[0], 2);
+    CHECK_EQ(degrees[3], 1);
+    CHECK(gra.has_node(3));  // revived, as add_edge() would
+    CHECK_EQ(gra.number_of_tombstones(), 0);
+    CHECK_EQ(gra.number_of_edges(), 2);
+
+    // an empty build leaves the view current
+    auto empty = xnetwork::GraphBuilder<>(4);
+    empty.build_into(gra);
+    CHECK_FALSE(degrees.is_stale());
+}
+
+TEST_CASE("Test ConcurrentGraphBuilder matches GraphBuilder") {
+    constexpr uint32_t num_nodes = 3000;
+    constexpr size_t num_shards = 4;
+    xnetwork::thread_pool pool(4);
+
+    auto reference = xnetwork::GraphBuilder<xnetwork::CsrGraph>(num_nodes);
+    auto simple = xnetwork::ConcurrentGraphBuilder<>(num_nodes, num_shards);
+    auto csr = xnetwork::ConcurrentGraphBuilder<xnetwork::CsrGraph>(num_nodes, num_shards);
+    for (uint32_t i = 0; i < num_nodes; ++i) {
+        for (uint32_t j : {(i * 7 + 3) % num_nodes, (i * 13 + 5) % num_nodes, i}) {
+            reference.add_edge(i, j);
+        }
+    }
+
+    // each producer thread fills its own shard; the CSR builder gets both directions
+    std::vector<std::future<void>> producers;
+    for (size_t sid = 0; sid != num_shards; ++sid) {
+        producers.push_back(pool.enqueue([&, sid]() {
+            for (auto i = static_cast<uint32_t>(sid); i < num_nodes; i += num_shards) {
+                for (uint32_t j : {(i * 7 + 3) % num_nodes, (i * 13 + 5) % num_nodes, i}) {
+                    simple.shard(sid).add_edge(i, j);
+                    csr.shard(sid).add_edge(j, i);
+                    csr.shard(sid).add_edge(i, j);
+                }
+            }
+        }));
+    }
+    for (auto& producer : producers) {
+        producer.get();
+    }
+
+    const auto expected = reference.build();
+    const auto gra = simple.build(pool);
+    const auto result = csr.build(pool);
+
+    CHECK_EQ(gra.number_of_nodes(), num_nodes);
+    CHECK_EQ(gra.number_of_edges(), expected.number_of_edges());
+    CHECK_EQ(result.number_of_edges(), expected.number_of_edges());
+    CHECK(result.edges() == expected.edges());
+    for (uint32_t i = 0; i < num_nodes; ++i) {
+        CHECK_EQ(gra.degree(i), expected.degree(i));
+        CHECK_EQ(result.degree(i), expected.degree(i));
+    }
+    expected.for_each_edge([&](uint32_t utx, uint32_t vtx) { CHECK(gra.has_edge(utx, vtx)); });
+}
+
+TEST_CASE("Test ConcurrentGraphBuilder with empty shards") {
+    xnetwork::thread_pool pool(2);
+    auto builder = xnetwork::ConcurrentGraphBuilder<xnetwork::CsrGraph>(5, 3);
+    builder.shard(1).add_edge(4, 0);
+    const auto csr = builder.build(pool);
+    CHECK_EQ(csr.number_of_nodes(), 5);
+    CHECK_EQ(csr.number_of_edges(), 1);
+    CHECK(csr.has_edge(0, 4));
+
+    auto empty = xnetwork::ConcurrentGraphBuilder<>(0, 2);
+    CHECK_EQ(empty.build(pool).number_of_nodes(), 0);
+}
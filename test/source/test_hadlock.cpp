@@ -101,6 +101,22 @@ TEST_CASE("Grid 2x2 is bipartite - all edges in cut") {
     CHECK_EQ(val, 4);
 }
 
+TEST_CASE("Mutable weight functor") {
+    TestGraph G(4, {{0, 1}, {0, 2}, {1, 3}, {2, 3}});
+    std::vector<std::vector<uint32_t>> faces = {{0, 1, 3, 2}, {0, 2, 3, 1}};
+    int calls = 0;
+    auto counting_weight = [calls](uint32_t, uint32_t) mutable -> int {
+        ++calls;
+        return 1;
+    };
+
+    auto cut = solve_hadlock_max_cut(G, counting_weight, faces);
+    CHECK_EQ(cut.size(), 4);
+    auto [ok, val] = validate_max_cut(G, cut, counting_weight);
+    CHECK(ok);
+    CHECK_EQ(val, 4);
+}
+
 TEST_CASE("Empty graph") {
     TestGraph G(0, {});
     std::vector<std::vector<uint32_t>> faces;
@@ -0,0 +1,76 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/labeled_graph.hpp>
+#include <xnetwork/cover.hpp>
+#include <xnetwork/exception.hpp>
+
+TEST_CASE("Test NodeInterner") {
+    xnetwork::NodeInterner<std::string> interner;
+    CHECK_EQ(interner.intern("a1"), 0);
+    CHECK_EQ(interner.intern("n2"), 1);
+    CHECK_EQ(interner.intern("a1"), 0);
+    CHECK_EQ(interner.size(), 2);
+    CHECK_EQ(interner.id("n2"), 1);
+    CHECK_EQ(interner.key(1), "n2");
+    CHECK(interner.contains("a1"));
+    CHECK_FALSE(interner.contains("zz"));
+    CHECK_THROWS_AS(interner.id("zz"), xnetwork::XNetworkError);
+}
+
+TEST_CASE("Test LabeledGraph") {
+    // a small netlist: cells a1..a3 connected through nets n1, n2
+    xnetwork::LabeledGraph<std::string> netlist;
+    const std::vector<std::pair<std::string, std::string>> pins{
+        {"a1", "n1"}, {"a2", "n1"}, {"a2", "n2"}, {"a3", "n2"}};
+    netlist.add_edges_from(pins);
+    netlist.add_node("a4");
+    netlist.add_edge("a1", "n1");  // duplicate
+
+    CHECK_EQ(netlist.number_of_nodes(), 6);
+    CHECK_EQ(netlist.number_of_edges(), 4);
+    CHECK(netlist.has_edge("n1", "a2"));
+    CHECK_FALSE(netlist.has_edge("a1", "a2"));
+    CHECK_FALSE(netlist.has_edge("a1", "missing"));
+    CHECK_EQ(netlist.degree("a2"), 2);
+    CHECK_EQ(netlist.degree("a4"), 0);
+    CHECK_EQ(netlist.neighbors("a3"), std::vector<std::string>{"n2"});
+    CHECK_EQ(netlist.key(netlist.id("n2")), "n2");
+    CHECK_THROWS_AS(netlist.degree("missing"), xnetwork::XNetworkError);
+
+    // the dense graph serves the uint32_t paths directly
+    const auto& gra = netlist.graph();
+    CHECK_EQ(gra.number_of_nodes(), 6);
+    CHECK(gra.has_edge(netlist.id("a3"), netlist.id("n2")));
+    CHECK_EQ(xnetwork::freeze(gra).number_of_edges(), 4);
+
+    netlist.remove_edge("a3", "n2");
+    CHECK_EQ(netlist.number_of_edges(), 3);
+}
+
+TEST_CASE("Test vertex cover on a labeled graph") {
+    xnetwork::LabeledGraph<std::string> netlist;
+    for (const auto* cell : {"a1", "a2", "a3"}) {
+        netlist.add_edge(cell, "n1");
+    }
+    netlist.add_edge("a3", "n2");
+
+    py::dict<std::string, int> weight{{"a1", 1}, {"a2", 1}, {"a3", 1}, {"n1", 5}, {"n2", 5}};
+    auto dense_weight = xnetwork::map_forward(netlist.interner(), weight);
+    py::set<uint32_t> soln{};
+    const auto [cover, cost] = min_vertex_cover(netlist.graph(), dense_weight, soln);
+    const auto labels = xnetwork::map_back(netlist.interner(), cover);
+    CHECK_EQ(labels.size(), cover.size());
+    CHECK((labels.contains("a1") && labels.contains("a2") && labels.contains("a3")));
+    CHECK_EQ(cost, 3);
+
+    const std::vector<uint32_t> path{netlist.id("a1"), netlist.id("n1"), netlist.id("a2")};
+    CHECK_EQ(xnetwork::map_back(netlist.interner(), path),
+             (std::vector<std::string>{"a1", "n1", "a2"}));
+}
@@ -0,0 +1,78 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <xnetwork/classes/compressed_graph.hpp>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/dense_graph.hpp>
+#include <xnetwork/classes/digraphs.hpp>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/classes/memory_usage.hpp>
+#include <xnetwork/cover.hpp>
+
+static auto create_wheel(uint32_t num_nodes) -> xnetwork::SimpleGraph {
+    xnetwork::SimpleGraph ugraph(num_nodes);
+    for (uint32_t node = 1; node != num_nodes; ++node) {
+        ugraph.add_edge(0, node);
+        ugraph.add_edge(node, node + 1 == num_nodes ? 1 : node + 1);
+    }
+    return ugraph;
+}
+
+TEST_CASE("Test memory_usage of graph classes") {
+    const auto ugraph = create_wheel(100);
+    const auto usage = ugraph.memory_usage();
+    CHECK_EQ(usage.nodes, 0);  // py::range holds no heap
+    CHECK_GE(usage.outer_adjacency, 100 * sizeof(py::set<uint32_t>));
+    CHECK_GE(usage.inner_adjacency, 2 * ugraph.number_of_edges() * sizeof(uint32_t));
+    CHECK_GT(usage.load_factor, 0.0);
+    CHECK_LE(usage.load_factor, 1.0);
+    CHECK_EQ(usage.total(),
+             usage.nodes + usage.outer_adjacency + usage.inner_adjacency + usage.other);
+
+    // the CSR snapshot is exactly its arrays, and smaller than the hashed graph
+    const auto csr = xnetwork::freeze(ugraph);
+    const auto csr_usage = csr.memory_usage();
+    CHECK_EQ(csr_usage.inner_adjacency, 2 * ugraph.number_of_edges() * sizeof(uint32_t));
+    CHECK_EQ(csr_usage.outer_adjacency, 101 * sizeof(xnetwork::CsrGraph::offset_t));
+    CHECK_LT(csr_usage.total(), usage.total());
+    CHECK_LT(xnetwork::compress(ugraph).memory_usage().inner_adjacency,
+             csr_usage.inner_adjacency);
+
+    xnetwork::DenseGraph dense(128);
+    CHECK_EQ(dense.memory_usage().total(), 128 * 2 * sizeof(uint64_t));
+
+    // the predecessor index of a digraph is reported separately
+    xnetwork::SimpleDiGraphS digraph(10);
+    for (uint32_t node = 0; node + 1 != 10; ++node) {
+        digraph.add_edge(node, node + 1);
+    }
+    const auto before = digraph.memory_usage();
+    digraph.enable_predecessors();
+    CHECK_GT(digraph.memory_usage().other, before.other);
+}
+
+TEST_CASE("Test WorkspaceProbe") {
+    const auto ugraph = create_wheel(40);
+    py::dict<uint32_t, int> weight;
+    for (uint32_t node = 0; node != 40; ++node) {
+        weight[node] = 1;
+    }
+
+    xnetwork::WorkspaceProbe probe;
+    CHECK_EQ(probe.peak_bytes(), 0);
+    py::set<uint32_t> soln{};
+    min_vertex_cover(ugraph, weight, soln);
+    const auto cover_peak = probe.peak_bytes();
+    CHECK_GT(cover_peak, 0);
+
+    {
+        // an inner probe sees only the work done while it is alive
+        xnetwork::WorkspaceProbe inner;
+        py::set<uint32_t> odd_soln{};
+        min_odd_cycle_cover(ugraph, weight, odd_soln);
+        CHECK_GT(inner.peak_bytes(), 0);
+    }
+    CHECK_EQ(probe.peak_bytes(), cover_peak);
+}
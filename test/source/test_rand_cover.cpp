@@ -5,6 +5,7 @@
 #include <py2cpp/range.hpp>
 #include <py2cpp/set.hpp>
 #include <utility>
+#include <vector>
 #include <xnetwork/classes/graph.hpp>  // for SimpleGraph
 #include <xnetwork/rand_cover.hpp>
 
@@ -212,3 +213,28 @@ TEST_CASE("rand_vertex_cover_mt larger graph") {
     CHECK_LE(cost, 8);  // can't exceed all vertices
     CHECK_GE(cost, 1);  // must have at least one vertex
 }
+
+TEST_CASE("rand_vertex_cover vector weights") {
+    xnetwork::SimpleGraph ugraph(6);
+    ugraph.add_edge(0, 1);
+    ugraph.add_edge(1, 2);
+    ugraph.add_edge(2, 3);
+    ugraph.add_edge(3, 4);
+    ugraph.add_edge(4, 5);
+    ugraph.add_edge(5, 0);
+    py::dict<uint32_t, int> weight{{0, 1}, {1, 3}, {2, 1}, {3, 2}, {4, 1}, {5, 2}};
+    const std::vector<int> dense_weight{1, 3, 1, 2, 1, 2};
+
+    // same seed, same draws: the result does not depend on the weight map type
+    auto [soln, cost] = rand_vertex_cover(ugraph, dense_weight, 7);
+    auto [dict_soln, dict_cost] = rand_vertex_cover(ugraph, weight, 7);
+    CHECK_EQ(cost, dict_cost);
+    CHECK(soln == dict_soln);
+    CHECK(is_valid_vertex_cover(ugraph, soln));
+
+    py::set<uint32_t> initial{1};
+    auto [mt_soln, mt_cost] = rand_vertex_cover_mt(ugraph, dense_weight, 16, 3, initial);
+    CHECK(mt_soln.contains(1));
+    CHECK(is_valid_vertex_cover(ugraph, mt_soln));
+    CHECK_GE(mt_cost, 3);
+}
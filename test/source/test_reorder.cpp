@@ -0,0 +1,162 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/cover.hpp>
+#include <xnetwork/graph_algo.hpp>
+#include <xnetwork/hadlock.hpp>
+#include <xnetwork/reorder.hpp>
+
+static auto create_scrambled_grid() -> xnetwork::SimpleGraph {
+    // 6 x 6 grid whose node ids are scattered by a multiplicative hash
+    const uint32_t side = 6;
+    const uint32_t num_nodes = side * side;
+    auto label = [&](uint32_t row, uint32_t col) { return (row * side + col) * 7 % num_nodes; };
+    xnetwork::SimpleGraph ugraph(num_nodes);
+    for (uint32_t row = 0; row < side; ++row) {
+        for (uint32_t col = 0; col < side; ++col) {
+            if (col + 1 < side) ugraph.add_edge(label(row, col), label(row, col + 1));
+            if (row + 1 < side) ugraph.add_edge(label(row, col), label(row + 1, col));
+        }
+    }
+    return ugraph;
+}
+
+static auto bandwidth(const xnetwork::CsrGraph& csr) -> uint32_t {
+    uint32_t result = 0;
+    csr.for_each_edge([&](uint32_t utx, uint32_t vtx) { result = std::max(result, vtx - utx); });
+    return result;
+}
+
+static auto check_relabeling(const xnetwork::SimpleGraph& ugraph,
+                             const xnetwork::Reordered<xnetwork::SimpleGraph>& result) {
+    const auto& perm = result.perm;
+    REQUIRE_EQ(perm.size(), ugraph.number_of_nodes());
+    for (uint32_t node = 0; node != perm.size(); ++node) {
+        CHECK_EQ(perm.to_new(perm.to_old(node)), node);
+    }
+    CHECK_EQ(result.graph.number_of_nodes(), ugraph.number_of_nodes());
+    CHECK_EQ(result.graph.number_of_edges(), ugraph.number_of_edges());
+    ugraph.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK(result.graph.has_edge(perm.to_new(utx), perm.to_new(vtx)));
+    });
+}
+
+TEST_CASE("Test reorder strategies are valid relabelings") {
+    const auto ugraph = create_scrambled_grid();
+    for (const auto strategy : {xnetwork::ReorderStrategy::rcm, xnetwork::ReorderStrategy::degree,
+                                xnetwork::ReorderStrategy::gorder}) {
+        check_relabeling(ugraph, xnetwork::reorder(ugraph, strategy));
+    }
+}
+
+TEST_CASE("Test RCM reduces bandwidth") {
+    const auto ugraph = create_scrambled_grid();
+    const auto before = bandwidth(xnetwork::freeze(ugraph));
+    const auto result = xnetwork::reorder(xnetwork::freeze(ugraph), xnetwork::ReorderStrategy::rcm);
+    const auto after = bandwidth(result.graph);
+    CHECK_LT(after, before);
+    CHECK_LE(after, 11);  // a 6 x 6 grid has bandwidth 6; RCM stays within twice that
+
+    // a path stays a path with consecutive ids
+    xnetwork::SimpleGraph path(5);
+    path.add_edge(3, 0);
+    path.add_edge(0, 4);
+    path.add_edge(4, 1);
+    path.add_edge(1, 2);
+    CHECK_EQ(bandwidth(xnetwork::freeze(
+                 xnetwork::reorder(path, xnetwork::ReorderStrategy::rcm).graph)),
+             1);
+}
+
+TEST_CASE("Test degree ordering puts hubs first") {
+    xnetwork::SimpleGraph ugraph(6);
+    for (uint32_t leaf : {0U, 1U, 2U, 3U}) {
+        ugraph.add_edge(5, leaf);
+    }
+    ugraph.add_edge(0, 4);
+    const auto result = xnetwork::reorder(ugraph, xnetwork::ReorderStrategy::degree);
+    CHECK_EQ(result.perm.to_old(0), 5);
+    CHECK_EQ(result.perm.to_old(1), 0);
+    CHECK_EQ(result.graph.degree(0), 4);
+    for (uint32_t node = 1; node + 1 < 6; ++node) {
+        CHECK_GE(result.graph.degree(node), result.graph.degree(node + 1));
+    }
+}
+
+TEST_CASE("Test mapping results back to original ids") {
+    const auto ugraph = create_scrambled_grid();
+    const auto result = xnetwork::reorder(ugraph, xnetwork::ReorderStrategy::gorder);
+
+    py::dict<uint32_t, int> weight;
+    for (uint32_t node = 0; node != ugraph.number_of_nodes(); ++node) {
+        weight[node] = static_cast<int>(node % 3) + 1;
+    }
+    auto new_weight = xnetwork::map_forward(result.perm, weight);
+    for (uint32_t node = 0; node != ugraph.number_of_nodes(); ++node) {
+        CHECK_EQ(new_weight[result.perm.to_new(node)], weight[node]);
+    }
+
+    // a cover of the relabeled graph maps to a cover of the original graph
+    const auto [cover, cost] = min_vertex_cover(result.graph, new_weight);
+    const auto original = xnetwork::map_back(result.perm, cover);
+    CHECK_EQ(original.size(), cover.size());
+    ugraph.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK((original.contains(utx) || original.contains(vtx)));
+    });
+    int original_cost = 0;
+    for (const auto node : original) {
+        original_cost += weight[node];
+    }
+    CHECK_EQ(original_cost, cost);
+
+    const std::vector<uint32_t> tour{0, 1, 2, 0};
+    const auto mapped_tour = xnetwork::map_back(result.perm, tour);
+    CHECK_EQ(mapped_tour.front(), mapped_tour.back());
+    CHECK_EQ(mapped_tour[1], result.perm.to_old(1));
+
+    const std::vector<std::pair<uint32_t, uint32_t>> cut{{0, 1}};
+    const auto mapped_cut = xnetwork::map_back(result.perm, cut);
+    CHECK(mapped_cut[0] == std::make_pair(result.perm.to_old(0), result.perm.to_old(1)));
+}
+
+TEST_CASE("Test mapping a Hadlock cut back to original ids") {
+    // square 0-1-2-3 with weights 5, 10, 5, 10 and the light diagonal 0-2
+    xnetwork::SimpleGraph ugraph(4);
+    ugraph.add_edge(0, 1);
+    ugraph.add_edge(1, 2);
+    ugraph.add_edge(2, 3);
+    ugraph.add_edge(3, 0);
+    ugraph.add_edge(0, 2);
+    auto weight = [](uint32_t utx, uint32_t vtx) -> int {
+        if (utx > vtx) std::swap(utx, vtx);
+        if (utx == 0 && vtx == 2) return 2;
+        if ((utx == 0 && vtx == 1) || (utx == 2 && vtx == 3)) return 5;
+        return 10;
+    };
+    const std::vector<std::vector<uint32_t>> faces = {{0, 1, 2}, {0, 2, 3}, {0, 3, 2, 1}};
+    const auto graph = xnetwork::freeze(ugraph);
+    const auto cut = solve_hadlock_max_cut(graph, weight, faces);
+
+    // degree order 0, 2, 1, 3 turns the edge 1-2 into 2-1
+    const auto result = xnetwork::reorder(graph, xnetwork::ReorderStrategy::degree);
+    REQUIRE_GT(result.perm.to_new(1), result.perm.to_new(2));
+    auto new_weight = [&](uint32_t utx, uint32_t vtx) {
+        return weight(result.perm.to_old(utx), result.perm.to_old(vtx));
+    };
+    std::vector<std::vector<uint32_t>> new_faces;
+    for (const auto& face : faces) {
+        auto& new_face = new_faces.emplace_back();
+        for (const auto node : face) {
+            new_face.push_back(result.perm.to_new(node));
+        }
+    }
+    const auto new_cut = solve_hadlock_max_cut(result.graph, new_weight, new_faces);
+    CHECK(xnetwork::map_back(result.perm, new_cut) == cut);
+}
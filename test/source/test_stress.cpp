@@ -21,7 +21,7 @@ TEST_CASE("Stress Test xnetwork::SimpleGraph") {
     // Clear the graph
     gra.clear();
 
-    // Check that the graph is empty (@todo)
-    // CHECK_EQ(gra.degree(0), 0);
-    // CHECK_EQ(gra.degree(num_nodes - 1), 0);
+    // Check that the graph is empty
+    CHECK_EQ(gra.degree(0), 0);
+    CHECK_EQ(gra.degree(num_nodes - 1), 0);
 }
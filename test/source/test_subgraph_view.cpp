@@ -0,0 +1,150 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <set>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/edge_index.hpp>
+#include <xnetwork/classes/filters.h>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/classes/node_bitset.hpp>
+#include <xnetwork/classes/subgraph_view.hpp>
+#include <xnetwork/cover.hpp>
+#include <xnetwork/graph_algo.hpp>
+
+static auto create_two_triangles() -> xnetwork::SimpleGraph {
+    // triangles 0-1-2 and 3-4-5 joined by the bridge 2-3
+    xnetwork::SimpleGraph ugraph(6);
+    ugraph.add_edge(0, 1);
+    ugraph.add_edge(1, 2);
+    ugraph.add_edge(2, 0);
+    ugraph.add_edge(2, 3);
+    ugraph.add_edge(3, 4);
+    ugraph.add_edge(4, 5);
+    ugraph.add_edge(5, 3);
+    return ugraph;
+}
+
+TEST_CASE("Test NodeBitset") {
+    xnetwork::NodeBitset bits(130);
+    CHECK(bits.empty());
+    CHECK(bits.insert(0));
+    CHECK(bits.insert(64));
+    CHECK(bits.insert(129));
+    CHECK_FALSE(bits.insert(64));
+    CHECK_EQ(bits.size(), 3);
+    CHECK(bits.contains(129));
+    CHECK_FALSE(bits.contains(1));
+    CHECK_FALSE(bits.contains(500));
+    CHECK_EQ(std::vector<uint32_t>(bits.begin(), bits.end()),
+             (std::vector<uint32_t>{0, 64, 129}));
+    CHECK_EQ(bits.erase(64), 1);
+    CHECK_EQ(bits.erase(64), 0);
+    CHECK_EQ(bits.size(), 2);
+
+    const auto all = xnetwork::NodeBitset::full(130);
+    CHECK_EQ(all.size(), 130);
+    CHECK_EQ(std::vector<uint32_t>(all.begin(), all.end()).size(), 130);
+    CHECK_FALSE(all.contains(130));
+    bits.clear();
+    CHECK(bits.empty());
+    CHECK(bits.begin() == bits.end());
+}
+
+TEST_CASE("Test SubGraphView hides nodes") {
+    const auto ugraph = create_two_triangles();
+    auto nodes = xnetwork::NodeBitset::full(6);
+    nodes.erase(2);
+    const xnetwork::SubGraphView<xnetwork::SimpleGraph> view(ugraph, nodes);
+
+    CHECK_EQ(view.number_of_nodes(), 5);
+    CHECK_FALSE(view.has_node(2));
+    CHECK_EQ(view.number_of_edges(), 4);
+    CHECK_EQ(view.degree(1), 1);
+    CHECK_EQ(view.degree(3), 2);
+    CHECK(view[0].contains(1));
+    CHECK_FALSE(view[1].contains(2));
+    CHECK_FALSE(view.has_edge(2, 3));
+    CHECK(view.has_edge(4, 3));
+
+    size_t count = 0;
+    view.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK_LT(utx, vtx);
+        CHECK(ugraph.has_edge(utx, vtx));
+        ++count;
+    });
+    CHECK_EQ(count, 4);
+    CHECK_EQ(view.edges().size(), 4);
+
+    // the view of a CSR graph agrees with the view of the adjacency-set graph
+    const auto csr = xnetwork::freeze(ugraph);
+    const xnetwork::SubGraphView<xnetwork::CsrGraph> csr_view(csr, nodes);
+    const auto simple_edges = view.edges();
+    const auto csr_edges = csr_view.edges();
+    using EdgeSet = std::set<std::pair<uint32_t, uint32_t>>;
+    CHECK(EdgeSet(simple_edges.begin(), simple_edges.end())
+          == EdgeSet(csr_edges.begin(), csr_edges.end()));
+
+    // filters.h predicates become a view with one evaluation per node
+    const auto filtered = xnetwork::subgraph_view(ugraph, hide_nodes(std::set<uint32_t>{2}));
+    CHECK_EQ(filtered.nodes(), nodes);
+    CHECK_EQ(xnetwork::subgraph_view(csr, show_nodes(nodes)).number_of_edges(), 4);
+}
+
+TEST_CASE("Test SubGraphView edge mask") {
+    const auto index = xnetwork::EdgeIndex::of(create_two_triangles());
+    const auto& csr = index.graph();
+    auto edges = xnetwork::NodeBitset::full(index.number_of_edges());
+    edges.erase(static_cast<uint32_t>(index.edge_id(2, 3)));  // cut the bridge
+    const xnetwork::SubGraphView<xnetwork::CsrGraph> view(
+        csr, xnetwork::NodeBitset::full(6), index, edges);
+
+    CHECK_EQ(view.number_of_nodes(), 6);
+    CHECK_EQ(view.number_of_edges(), 6);
+    CHECK_FALSE(view.has_edge(3, 2));
+    CHECK(view.has_edge(3, 4));
+    CHECK_EQ(view.degree(2), 2);
+    CHECK_FALSE(view[3].contains(2));
+    view.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK_FALSE((utx == 2 && vtx == 3));
+    });
+}
+
+TEST_CASE("Test covering the remainder through a view") {
+    const auto ugraph = create_two_triangles();
+    py::dict<uint32_t, int> weight;
+    for (uint32_t node = 0; node != 6; ++node) {
+        weight[node] = 1;
+    }
+
+    // node 2 is already chosen: solve only what it leaves uncovered
+    auto nodes = xnetwork::NodeBitset::full(6);
+    nodes.erase(2);
+    const xnetwork::SubGraphView<xnetwork::SimpleGraph> rest(ugraph, nodes);
+    for (int run = 0; run != 2; ++run) {
+        py::set<uint32_t> soln{};
+        const auto [cover, cost] = run == 0 ? min_vertex_cover(rest, weight, soln)
+                                            : min_vertex_cover_fast(rest, weight, soln);
+        CHECK_FALSE(cover.contains(2));
+        auto full_cover = cover.copy();
+        full_cover.insert(2);
+        ugraph.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+            CHECK((full_cover.contains(utx) || full_cover.contains(vtx)));
+        });
+        CHECK_EQ(cost, static_cast<int>(cover.size()));
+    }
+
+    py::set<uint32_t> indset{};
+    py::set<uint32_t> dep{};
+    const auto [mis, cost] = min_maximal_independant_set(rest, weight, indset, dep);
+    CHECK_FALSE(mis.contains(2));
+    for (const auto utx : mis) {
+        for (const auto vtx : rest[utx]) {
+            CHECK_FALSE(mis.contains(vtx));
+        }
+    }
+    CHECK_EQ(cost, static_cast<int>(mis.size()));
+}
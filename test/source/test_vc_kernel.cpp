@@ -0,0 +1,189 @@
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <py2cpp/dict.hpp>
+#include <py2cpp/set.hpp>
+#include <random>
+#include <utility>
+#include <vector>
+#include <xnetwork/classes/csr_graph.hpp>
+#include <xnetwork/classes/graph.hpp>  // for SimpleGraph
+#include <xnetwork/classes/node_bitset.hpp>
+#include <xnetwork/graph_algo.hpp>
+#include <xnetwork/vc_kernel.hpp>
+
+// Exhaustive minimum weight vertex cover (small graphs only)
+static auto brute_force_cover(const xnetwork::SimpleGraph& ugraph, const std::vector<int>& weight)
+    -> std::pair<py::set<uint32_t>, int> {
+    const auto num_nodes = static_cast<uint32_t>(ugraph.number_of_nodes());
+    uint32_t best_mask = (1U << num_nodes) - 1;
+    int best = 0;
+    for (const auto wgt : weight) best += wgt;
+    for (uint32_t mask = 0; mask != (1U << num_nodes); ++mask) {
+        bool covers = true;
+        ugraph.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+            covers = covers && (((mask >> utx) | (mask >> vtx)) & 1U) != 0;
+        });
+        if (!covers) continue;
+        int cost = 0;
+        for (uint32_t node = 0; node != num_nodes; ++node) {
+            if ((mask >> node) & 1U) cost += weight[node];
+        }
+        if (cost < best) {
+            best = cost;
+            best_mask = mask;
+        }
+    }
+    py::set<uint32_t> cover;
+    for (uint32_t node = 0; node != num_nodes; ++node) {
+        if ((best_mask >> node) & 1U) cover.insert(node);
+    }
+    return {cover, best};
+}
+
+template <typename CoverSet>
+static auto check_cover(const xnetwork::SimpleGraph& ugraph, const std::vector<int>& weight,
+                        const CoverSet& cover) -> int {
+    ugraph.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        CHECK((cover.contains(utx) || cover.contains(vtx)));
+    });
+    int cost = 0;
+    for (const auto node : cover) cost += weight[node];
+    return cost;
+}
+
+// No degree-0/1 node and no dominated node survives in the kernel
+static auto is_locally_reduced(const xnetwork::SimpleGraph& kernel_graph,
+                               const std::vector<int>& weight) -> bool {
+    bool reduced = true;
+    kernel_graph.for_each_edge([&](uint32_t utx, uint32_t vtx) {
+        for (const auto& [node, nbr] : {std::pair{utx, vtx}, std::pair{vtx, utx}}) {
+            if (weight[nbr] > weight[node]) continue;
+            bool dominates = true;
+            for (const auto other : kernel_graph[node]) {
+                dominates = dominates && (other == nbr || kernel_graph[nbr].contains(other));
+            }
+            reduced = reduced && !dominates;
+        }
+    });
+    for (uint32_t node = 0; node != kernel_graph.number_of_nodes(); ++node) {
+        reduced = reduced && kernel_graph[node].size() >= 2;
+    }
+    return reduced;
+}
+
+TEST_CASE("Test vertex_cover_kernel solves trees and cycles") {
+    // path of 10 unit-weight nodes: degree-1 rules only
+    xnetwork::SimpleGraph path(10);
+    for (uint32_t node = 0; node + 1 != 10; ++node) path.add_edge(node, node + 1);
+    const auto path_kernel = vertex_cover_kernel(path, std::vector<int>(10, 1));
+    CHECK_EQ(path_kernel.graph.number_of_nodes(), 0);
+    CHECK_EQ(path_kernel.offset, 5);
+    const auto path_cover = path_kernel.lift(py::set<uint32_t>{});
+    CHECK_EQ(check_cover(path, std::vector<int>(10, 1), path_cover), 5);
+
+    // 5-cycle: one degree-2 fold leaves a triangle, which domination clears
+    xnetwork::SimpleGraph cycle(5);
+    for (uint32_t node = 0; node != 5; ++node) cycle.add_edge(node, (node + 1) % 5);
+    py::dict<uint32_t, int> weight{{0, 1}, {1, 1}, {2, 1}, {3, 1}, {4, 1}};
+    const auto cycle_kernel = vertex_cover_kernel(cycle, weight);
+    CHECK_EQ(cycle_kernel.graph.number_of_nodes(), 0);
+    CHECK_EQ(cycle_kernel.offset, 3);
+    const auto cycle_cover = cycle_kernel.lift(py::set<uint32_t>{});
+    CHECK_EQ(check_cover(cycle, std::vector<int>(5, 1), cycle_cover), 3);
+
+    // weighted pendant: the leaf is cheaper, so it is paid up front
+    xnetwork::SimpleGraph star(4);
+    for (uint32_t leaf = 1; leaf != 4; ++leaf) star.add_edge(0, leaf);
+    const std::vector<int> star_weight{5, 1, 1, 1};
+    const auto star_kernel = vertex_cover_kernel(xnetwork::freeze(star), star_weight);
+    CHECK_EQ(star_kernel.graph.number_of_nodes(), 0);
+    CHECK_EQ(star_kernel.offset, 3);
+    CHECK_EQ(check_cover(star, star_weight, star_kernel.lift(py::set<uint32_t>{})), 3);
+}
+
+TEST_CASE("Test vertex_cover_kernel keeps an irreducible core") {
+    // Petersen graph: 3-regular, triangle-free, LP optimum all 1/2
+    xnetwork::SimpleGraph petersen(10);
+    for (uint32_t node = 0; node != 5; ++node) {
+        petersen.add_edge(node, (node + 1) % 5);
+        petersen.add_edge(node, node + 5);
+        petersen.add_edge(node + 5, (node + 2) % 5 + 5);
+    }
+    const std::vector<int> weight(10, 1);
+    const auto kernel = vertex_cover_kernel(petersen, weight);
+    CHECK_EQ(kernel.graph.number_of_nodes(), 10);
+    CHECK_EQ(kernel.graph.number_of_edges(), 15);
+    CHECK_EQ(kernel.offset, 0);
+    CHECK(kernel.steps.empty());
+}
+
+TEST_CASE("Test vertex_cover_kernel preserves the optimum") {
+    std::mt19937 rng{2024};
+    for (int trial = 0; trial != 40; ++trial) {
+        const uint32_t num_nodes = 12;
+        const double density = 0.12 + 0.02 * (trial % 10);
+        std::bernoulli_distribution has_edge(density);
+        std::uniform_int_distribution<int> draw_weight(1, 6);
+        xnetwork::SimpleGraph ugraph(num_nodes);
+        for (uint32_t utx = 0; utx != num_nodes; ++utx) {
+            for (uint32_t vtx = utx + 1; vtx != num_nodes; ++vtx) {
+                if (has_edge(rng)) ugraph.add_edge(utx, vtx);
+            }
+        }
+        std::vector<int> weight(num_nodes);
+        for (auto& wgt : weight) wgt = draw_weight(rng);
+
+        const auto kernel = vertex_cover_kernel(ugraph, weight);
+        CHECK_LE(kernel.graph.number_of_nodes(), num_nodes);
+        const auto [kernel_opt_cover, kernel_opt] = brute_force_cover(kernel.graph, kernel.weight);
+        const auto [opt_cover, opt] = brute_force_cover(ugraph, weight);
+        CHECK_EQ(kernel.offset + kernel_opt, opt);
+        CHECK(is_locally_reduced(kernel.graph, kernel.weight));
+
+        // lifting keeps the weight: an optimal kernel cover lifts to an optimal cover
+        const auto lifted = kernel.lift(kernel_opt_cover);
+        CHECK_EQ(check_cover(ugraph, weight, lifted), opt);
+
+        // and an approximate one keeps its weight too
+        auto kernel_weight = kernel.weight;
+        xnetwork::NodeBitset kernel_soln(kernel.graph.number_of_nodes());
+        const auto [approx, approx_cost]
+            = min_vertex_cover_fast(kernel.graph, kernel_weight, kernel_soln);
+        CHECK_EQ(check_cover(ugraph, weight, kernel.lift(approx)), kernel.offset + approx_cost);
+    }
+}
+
+TEST_CASE("Test vertex_cover_kernel revisits nodes after a pendant") {
+    // pendant 7 lowers w(0) to 2, so 0 then dominates its neighbor 4
+    xnetwork::SimpleGraph ugraph(8);
+    const std::vector<std::pair<uint32_t, uint32_t>> edges{
+        {0, 7}, {0, 6}, {0, 5}, {0, 4}, {1, 4}, {2, 7}, {2, 6}, {2, 3}, {4, 6}, {5, 6}};
+    for (const auto& [utx, vtx] : edges) ugraph.add_edge(utx, vtx);
+    const std::vector<int> weight{5, 1, 1, 4, 4, 3, 4, 3};
+    const auto kernel = vertex_cover_kernel(ugraph, weight);
+    CHECK(is_locally_reduced(kernel.graph, kernel.weight));
+    const auto [kernel_opt_cover, kernel_opt] = brute_force_cover(kernel.graph, kernel.weight);
+    const auto [opt_cover, opt] = brute_force_cover(ugraph, weight);
+    CHECK_EQ(kernel.offset + kernel_opt, opt);
+    CHECK_EQ(check_cover(ugraph, weight, kernel.lift(kernel_opt_cover)), opt);
+}
+
+TEST_CASE("Test vertex_cover_kernel with weights near the int limit") {
+    // node 0 joins two triangles; w(1) + w(2) overflows int and must not
+    // trigger the degree-2 "take both neighbors" rule
+    xnetwork::SimpleGraph ugraph(7);
+    ugraph.add_edge(0, 1);
+    ugraph.add_edge(0, 2);
+    for (const uint32_t apex : {1U, 2U}) {
+        const auto base = 2 * apex + 1;
+        ugraph.add_edge(apex, base);
+        ugraph.add_edge(apex, base + 1);
+        ugraph.add_edge(base, base + 1);
+    }
+    const std::vector<int> weight{10, 1200000000, 1200000000, 1, 1, 1, 1};
+    const auto kernel = vertex_cover_kernel(ugraph, weight);
+    CHECK_EQ(kernel.graph.number_of_nodes(), 0);
+    CHECK_EQ(kernel.offset, 14);
+    CHECK_EQ(check_cover(ugraph, weight, kernel.lift(py::set<uint32_t>{})), 14);
+}
@@ -1,11 +1,14 @@
 // -*- coding: utf-8 -*-
 #include <doctest/doctest.h>  // for ResultBuilder, TestCase, CHECK
 
+#include <algorithm>                      // for all_of
 #include <array>                          // for array
+#include <cstdint>                        // for uint32_t
 #include <string>                         // for basic_string, operator==
 #include <utility>                        // for pair
 #include <vector>                         // for vector
 #include <xnetwork/classes/digraphs.hpp>  // for DiGraphS
+#include <xnetwork/exception.hpp>         // for XNetworkError
 
 template <typename Container> inline auto create_test_case4(const Container& weights) {
     using Edge = std::pair<std::string, std::string>;
@@ -48,3 +51,124 @@ TEST_CASE("Test xnetwork Negative Cycle") {
     auto gra = create_test_case4(weights);
     do_case(gra);
 }
+
+TEST_CASE("Test xnetwork DiGraphS predecessors") {
+    auto weights = std::array<int, 5>{-5, 1, 1, 1, 1};
+    auto gra = create_test_case4(weights);
+    CHECK_EQ(gra.number_of_edges(), 5);
+    CHECK_FALSE(gra.has_predecessor_index());
+    CHECK_THROWS_AS(gra.in_degree("A"), xnetwork::XNetworkError);
+
+    gra.enable_predecessors();
+    CHECK(gra.has_predecessor("B", "A"));
+    CHECK_FALSE(gra.has_predecessor("A", "B"));
+    CHECK_EQ(gra.in_degree("A"), 1);
+
+    gra.add_edge("C", "A");
+    gra.add_edge("C", "A");  // duplicate is ignored
+    CHECK_EQ(gra.number_of_edges(), 6);
+    CHECK_EQ(gra.in_degree("A"), 2);
+    CHECK(gra.predecessors("A").contains("C"));
+}
+
+TEST_CASE("Test xnetwork SimpleDiGraphS predecessors") {
+    xnetwork::SimpleDiGraphS gra(4);
+    gra.add_edge(0U, 1U);
+    gra.enable_predecessors();
+    gra.add_edge(0U, 2U);
+    gra.add_edge(1U, 2U);
+    gra.add_edge(2U, 3U);
+    gra.add_edge(2U, 3U);
+    CHECK_EQ(gra.number_of_edges(), 4);
+    CHECK_EQ(gra.in_degree(0), 0);
+    CHECK_EQ(gra.in_degree(1), 1);
+    CHECK_EQ(gra.in_degree(2), 2);
+    CHECK_EQ(gra.out_degree(2), 1);
+
+    // backward reachability from node 3 without building a reversed copy
+    std::vector<bool> seen(4, false);
+    std::vector<uint32_t> stack{3};
+    seen[3] = true;
+    while (!stack.empty()) {
+        const auto node = stack.back();
+        stack.pop_back();
+        for (const auto& pred : gra.predecessors(node)) {
+            if (!seen[pred]) {
+                seen[pred] = true;
+                stack.push_back(pred);
+            }
+        }
+    }
+    CHECK(std::all_of(seen.begin(), seen.end(), [](bool b) { return b; }));
+
+    const auto& cgra = gra;
+    const auto pred = cgra.pred();
+    CHECK_EQ(pred.size(), 4);
+    CHECK(pred.at(2U).contains(1U));
+    CHECK_EQ(pred[0U].size(), 0);
+
+    gra.clear();
+    CHECK_EQ(gra.number_of_edges(), 0);
+    CHECK(gra.has_predecessor_index());
+    CHECK_EQ(gra.number_of_nodes(), 4);
+    CHECK_EQ(gra.degree(2U), 0);
+    CHECK_EQ(gra.in_degree(2U), 0);
+
+    // the cleared graph is still usable and keeps its index in sync
+    gra.add_edge(3U, 0U);
+    CHECK_EQ(gra.number_of_edges(), 1);
+    CHECK_EQ(gra.in_degree(0U), 1);
+    CHECK_EQ(gra.in_degree(1U), 0);
+}
+
+TEST_CASE("Test xnetwork SimpleDiGraphS removal") {
+    xnetwork::SimpleDiGraphS gra(4);
+    gra.enable_predecessors();
+    gra.add_edge(0U, 1U);
+    gra.add_edge(1U, 0U);
+    gra.add_edge(1U, 2U);
+    gra.add_edge(2U, 3U);
+    gra.add_edge(3U, 1U);
+    gra.add_edge(1U, 1U);
+
+    gra.remove_edge(0U, 1U);
+    CHECK_EQ(gra.number_of_edges(), 5);
+    CHECK_FALSE(gra.has_predecessor(1U, 0U));
+    CHECK_THROWS_AS(gra.remove_edge(0U, 1U), xnetwork::XNetworkError);
+
+    gra.remove_node(1U);
+    CHECK_EQ(gra.number_of_edges(), 1);
+    CHECK_EQ(gra.number_of_nodes(), 4);
+    CHECK_EQ(gra.number_of_live_nodes(), 3);
+    CHECK_EQ(gra.in_degree(0U), 0);
+    CHECK_EQ(gra.in_degree(2U), 0);
+
+    const auto new_to_old = gra.compact();
+    CHECK_EQ(new_to_old, (std::vector<uint32_t>{0, 2, 3}));
+    CHECK(gra.has_successor(1U, 2U));  // old 2 -> 3
+    CHECK(gra.has_predecessor(2U, 1U));
+    CHECK_EQ(gra.number_of_edges(), 1);
+}
+
+TEST_CASE("Test xnetwork SimpleDiGraphS remove_node without index") {
+    xnetwork::SimpleDiGraphS gra(3);
+    gra.add_edge(0U, 1U);
+    gra.add_edge(2U, 1U);
+    gra.add_edge(1U, 0U);
+    gra.remove_node(1U);
+    CHECK_EQ(gra.number_of_edges(), 0);
+    CHECK(gra.successors(2U).empty());
+}
+
+TEST_CASE("Test xnetwork SimpleDiGraphS append_node with index") {
+    xnetwork::SimpleDiGraphS gra(2);
+    gra.enable_predecessors();
+    gra.add_edge(0U, 1U);
+    const auto node = gra.append_node();
+    CHECK_EQ(node, 2U);
+    gra.add_edge(0U, node);
+    gra.add_edge(node, 1U);
+    CHECK(gra.has_predecessor(node, 0U));
+    CHECK_EQ(gra.in_degree(node), 1);
+    CHECK_EQ(gra.in_degree(1U), 2);
+}
@@ -2,10 +2,13 @@
 #include <doctest/doctest.h>  // for ResultBuilder, TestCase, CHECK
 
 #include <cstdint>                     // for uint8_t
+#include <iterator>                    // for distance
+#include <utility>                     // for pair
 #include <py2cpp/dict.hpp>             // for dict<>::Base
 #include <py2cpp/set.hpp>              // for set
 #include <vector>                      // for vector
 #include <xnetwork/classes/graph.hpp>  // for Graph, SimpleGraph
+#include <xnetwork/exception.hpp>      // for XNetworkError
 
 /**
  * @brief
@@ -133,7 +136,14 @@ TEST_CASE("Test xnetwork::Graph (clear)") {
     gra.add_edges_from(edges);
     gra.clear();
     CHECK_EQ(gra.number_of_nodes(), 4);
-    CHECK_EQ(gra.adj().size(), 0);
+    CHECK_EQ(gra.number_of_edges(), 0);
+    CHECK_EQ(gra.degree(2U), 0);
+
+    // the cleared graph is still usable
+    gra.add_edge(0U, 1U);
+    CHECK_EQ(gra.number_of_edges(), 1);
+    CHECK_EQ(gra.degree(0U), 1);
+    CHECK_EQ(gra.degree(3U), 0);
 }
 
 TEST_CASE("Test xnetwork::Graph (is_multigraph)") {
@@ -145,3 +155,128 @@ TEST_CASE("Test xnetwork::Graph (is_directed)") {
     auto gra = xnetwork::SimpleGraph(4);
     CHECK_FALSE(gra.is_directed());
 }
+
+TEST_CASE("Test xnetwork::Graph (duplicate edges)") {
+    auto gra = xnetwork::SimpleGraph(4);
+    gra.add_edge(0, 1);
+    gra.add_edge(0, 1);
+    gra.add_edge(1, 0);
+    gra.add_edge(2, 3);
+    CHECK_EQ(gra.number_of_edges(), 2);
+}
+
+TEST_CASE("Test xnetwork::Graph (remove_edge)") {
+    using Edge = std::pair<unsigned int, unsigned int>;
+    std::vector<Edge> edges{{0, 1}, {1, 2}, {2, 3}, {3, 3}};
+    auto gra = xnetwork::SimpleGraph(4);
+    gra.add_edges_from(edges);
+    CHECK_EQ(gra.number_of_edges(), 4);
+
+    gra.remove_edge(1, 0);
+    CHECK_FALSE(gra.has_edge(0, 1));
+    CHECK_FALSE(gra.has_edge(1, 0));
+    CHECK_EQ(gra.number_of_edges(), 3);
+    CHECK_THROWS_AS(gra.remove_edge(0, 1), xnetwork::XNetworkError);
+
+    std::vector<Edge> to_remove{{3, 3}, {0, 1}, {2, 1}};
+    gra.remove_edges_from(to_remove);
+    CHECK_EQ(gra.number_of_edges(), 1);
+    CHECK(gra.has_edge(3, 2));
+}
+
+TEST_CASE("Test xnetwork::Graph (remove_node and compact)") {
+    using Edge = std::pair<unsigned int, unsigned int>;
+    std::vector<Edge> edges{{0, 1}, {0, 2}, {1, 2}, {2, 3}, {3, 4}, {1, 1}};
+    auto gra = xnetwork::SimpleGraph(5);
+    gra.add_edges_from(edges);
+
+    gra.remove_node(1);
+    CHECK_FALSE(gra.has_node(1));
+    CHECK_EQ(gra.number_of_nodes(), 5);
+    CHECK_EQ(gra.number_of_live_nodes(), 4);
+    CHECK_EQ(gra.number_of_edges(), 3);
+    CHECK_EQ(gra.degree(0), 1);
+    CHECK_THROWS_AS(gra.remove_node(1), xnetwork::XNetworkError);
+
+    const auto new_to_old = gra.compact();
+    CHECK_EQ(new_to_old, (std::vector<uint32_t>{0, 2, 3, 4}));
+    CHECK_EQ(gra.number_of_nodes(), 4);
+    CHECK_EQ(gra.number_of_live_nodes(), 4);
+    CHECK_EQ(gra.number_of_tombstones(), 0);
+    CHECK_EQ(gra.number_of_edges(), 3);
+    CHECK(gra.has_edge(0, 1));  // old (0, 2)
+    CHECK(gra.has_edge(1, 2));  // old (2, 3)
+    CHECK(gra.has_edge(2, 3));  // old (3, 4)
+    do_case(gra);
+}
+
+TEST_CASE("Test xnetwork::Graph (lazy edges view)") {
+    using Edge = std::pair<unsigned int, unsigned int>;
+    std::vector<Edge> edges{{0, 1}, {1, 2}, {2, 3}, {3, 3}, {3, 0}};
+    auto gra = xnetwork::SimpleGraph(5);
+    gra.add_edges_from(edges);
+
+    const auto view = gra.edges();
+    CHECK_EQ(view.size(), 4);  // the self loop is not reported
+    CHECK_FALSE(view.empty());
+    auto count = 0U;
+    for (const auto& [utx, vtx] : view) {
+        CHECK_LT(utx, vtx);
+        CHECK(gra.has_edge(utx, vtx));
+        ++count;
+    }
+    CHECK_EQ(count, 4);
+    CHECK(view == gra.edges());  // multi-pass
+
+    // the view follows later changes to the graph
+    gra.add_edge(4, 2);
+    CHECK_EQ(view.size(), 5);
+    CHECK_EQ(std::distance(view.begin(), view.end()), 5);
+
+    CHECK(xnetwork::SimpleGraph(3).edges().empty());
+}
+
+TEST_CASE("Test xnetwork::Graph (degree view)") {
+    // star 0 - {1, 2, 3} plus the edge 1 - 2; node 4 is isolated
+    auto gra = xnetwork::SimpleGraph(5);
+    gra.add_edges_from(std::vector<std::pair<unsigned int, unsigned int>>{
+        {0, 1}, {0, 2}, {0, 3}, {1, 2}});
+
+    const auto view = gra.degree_view();
+    CHECK_EQ(view[0], 3);
+    CHECK_EQ(view[4], 0);
+    CHECK_EQ(view.max_degree(), 3);
+    CHECK_EQ(view.histogram(), (std::vector<size_t>{1, 1, 2, 1}));
+    CHECK_EQ(view.nodes_by_degree(), (std::vector<uint32_t>{0, 1, 2, 3, 4}));
+    CHECK_EQ(view.nodes_by_degree(false), (std::vector<uint32_t>{4, 3, 1, 2, 0}));
+    CHECK_FALSE(view.is_stale());
+
+    // mutation invalidates the cached degrees
+    const auto version = gra.version();
+    gra.add_edge(4, 3);
+    CHECK_GT(gra.version(), version);
+    CHECK(view.is_stale());
+    CHECK_EQ(view[4], 1);
+    CHECK_EQ(view.histogram(), (std::vector<size_t>{0, 1, 3, 1}));
+
+    gra.add_edge(4, 3);  // no change
+    CHECK_FALSE(view.is_stale());
+
+    gra.remove_node(0);
+    CHECK_EQ(view.max_degree(), 1);
+    CHECK_EQ(view.nodes_by_degree(), (std::vector<uint32_t>{1, 2, 3, 4}));
+}
+
+TEST_CASE("Test xnetwork::Graph (add_edge revives a removed node)") {
+    auto gra = xnetwork::SimpleGraph(3);
+    gra.add_edge(0, 1);
+    gra.remove_node(1);
+    CHECK_FALSE(gra.has_node(1));
+    CHECK_EQ(gra.number_of_tombstones(), 1);
+
+    gra.add_edge(1, 2);
+    CHECK(gra.has_node(1));
+    CHECK_EQ(gra.number_of_tombstones(), 0);
+    CHECK_EQ(gra.number_of_live_nodes(), 3);
+    CHECK_EQ(gra.number_of_edges(), 1);
+}